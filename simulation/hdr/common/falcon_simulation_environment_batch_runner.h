@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_batch_runner.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment parameter sweep batch runner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a batch runner that executes the trials of a parameter sweep on a
+ *  pool of local worker processes. Worker processes pull trials from the
+ *  parent one at a time over pipes, so long and short trials balance
+ *  naturally, and keep one initialized manager per scenario that is returned
+ *  to its post-initialization snapshot between trials.
+ *
+ * A worker process that exits is replaced, and the trial it was running is
+ *  retried on another worker up to FALCON_BATCH_MAX_TRIAL_ATTEMPTS times in
+ *  all before it is recorded as failed.
+ *
+ * The parent process is the only writer of the results file: one line per
+ *  trial, flushed to disk as soon as the trial completes. A sweep whose
+ *  results file already exists resumes, skipping every trial that previously
+ *  completed successfully.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Replace exited workers and retry their trials.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_BATCH_RUNNER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_BATCH_RUNNER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_sweep_spec.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* reported for a trial whose worker process exited before producing a result
+ *  on every attempt */
+const char * const FALCON_BATCH_WORKER_EXITED_STR = "WORKER_EXITED";
+
+/* attempts at a trial whose worker process keeps exiting before giving up */
+const uint32_t FALCON_BATCH_MAX_TRIAL_ATTEMPTS = 3;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+enum class FALCON_BATCH_RUNNER_STATUS_ENUM : uint32_t
+{
+    SUCCESS = 0,
+    INVALID_RESULTS_FILE,
+    WORKER_FAILURE,
+    TRIAL_FAILURE,
+    NUMBER_OF_STATUS_CODES
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_batch_runner
+{
+public:
+
+    falcon_simulation_environment_batch_runner(void);
+    virtual ~falcon_simulation_environment_batch_runner(void);
+
+    FALCON_BATCH_RUNNER_STATUS_ENUM run(const falcon_simulation_environment_sweep_spec &spec,
+                                        const std::string &results_path,
+                                        uint32_t num_workers);
+
+    const char * get_batch_runner_status_str(FALCON_BATCH_RUNNER_STATUS_ENUM status_code) const;
+
+private:
+
+    /* parent-side bookkeeping for one worker process */
+    struct worker_process
+    {
+        pid_t                      pid;
+        int                        command_fd;
+        int                        result_fd;
+        std::string                pending_output;
+        bool                       busy;
+        FalconTrialId              trial_id;
+    };
+
+    /* worker-side manager kept across trials of the same scenario */
+    struct scenario_instance
+    {
+        std::unique_ptr<falcon_simulation_environment_manager>    manager;
+        bool                                                      reusable;
+    };
+
+    FALCON_BATCH_RUNNER_STATUS_ENUM open_results_file(const std::string &results_path, uint64_t fingerprint);
+    bool spawn_worker(worker_process &worker);
+    void dispatch_next_trial(worker_process &worker);
+    void collect_worker_output(worker_process &worker);
+    void replace_exited_worker(worker_process &worker);
+    void record_result(const std::string &line);
+
+    void worker_main(int command_fd, int result_fd);
+    std::string run_trial(const falcon_simulation_environment_sweep_trial &trial);
+    FALCON_MANAGER_STATUS_ENUM prepare_scenario(const std::string &scenario_name, scenario_instance &instance);
+
+    static const char * batch_runner_status_names[static_cast<uint32_t>(FALCON_BATCH_RUNNER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)];
+
+    const FalconSweepTrialList *                  m_trials;
+    std::set<FalconTrialId>                       m_completed_trials;
+    std::deque<FalconTrialId>                     m_pending_trials;
+    std::map<FalconTrialId, uint32_t>             m_trial_attempts;
+    FILE *                                        m_results_file;
+    uint32_t                                      m_num_recorded;
+    uint32_t                                      m_num_failed;
+
+    std::vector<worker_process>                   m_workers;
+    std::map<std::string, scenario_instance>      m_scenario_instances;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_BATCH_RUNNER_H__
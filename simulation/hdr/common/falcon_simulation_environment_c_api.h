@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_c_api.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment C interface.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a C ABI around the simulation environment manager for use by
+ *  language bindings. Observation, action and reward buffers are owned by the
+ *  manager and exposed as raw pointers that remain valid until the simulation
+ *  is destroyed, so bindings can wrap them without copying.
+ *
+ * Functions returning int return a FALCON_MANAGER_STATUS_ENUM value; zero
+ *  indicates success. The negative FALCON_SIMULATION_* codes below are
+ *  returned for invalid arguments and for failures caught at the C boundary;
+ *  no C++ exception ever crosses it. Functions returning pointers or values
+ *  return nullptr or zero when given a null handle.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added C interface error codes.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_C_API_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_C_API_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* a null handle or pointer, or an argument count below zero */
+#define FALCON_SIMULATION_INVALID_ARGUMENT    (-1)
+
+/* an exception was raised inside the simulation environment */
+#define FALCON_SIMULATION_INTERNAL_ERROR      (-2)
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef struct falcon_simulation falcon_simulation;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            FUNCTION DECLARATIONS
+ *****************************************************************************/
+
+falcon_simulation * falcon_simulation_create(const char *scenario_name);
+
+/* shuts the simulation down first if that has not been done */
+void falcon_simulation_destroy(falcon_simulation *sim);
+
+/* argv follows the command-line conventions of the falcon_simulation
+ *  application, without the leading program name; may be called only once
+ *  per handle, even if it fails */
+int falcon_simulation_initialize(falcon_simulation *sim, int argc, const char **argv);
+
+/* the action buffer must be filled before each call */
+int falcon_simulation_step(falcon_simulation *sim);
+
+int falcon_simulation_snapshot(falcon_simulation *sim);
+int falcon_simulation_reset(falcon_simulation *sim);
+
+/* a no-op for handles that were never successfully initialized or that have
+ *  already been shut down */
+int falcon_simulation_shutdown(falcon_simulation *sim);
+
+float * falcon_simulation_get_observations(falcon_simulation *sim, size_t *num_values);
+float * falcon_simulation_get_actions(falcon_simulation *sim, size_t *num_values);
+int32_t * falcon_simulation_get_rewards(falcon_simulation *sim, size_t *num_values);
+
+int32_t falcon_simulation_get_timestep_reward(falcon_simulation *sim);
+int64_t falcon_simulation_get_cumulative_reward(falcon_simulation *sim);
+uint32_t falcon_simulation_get_current_timestep(falcon_simulation *sim);
+
+const char * falcon_simulation_get_status_str(falcon_simulation *sim, int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_C_API_H__
@@ -0,0 +1,731 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_channel.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment inter-component message channels.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines typed, lock-free message channels that components use to exchange
+ *  data without reaching into each other's state. Each channel has a single
+ *  consumer and one or more producers; every producer owns a dedicated
+ *  single-producer/single-consumer (SPSC) ring buffer lane so that the
+ *  multi-producer (MPSC) case never requires a compare-and-swap loop.
+ *
+ * Channels are double-buffered in time: a message published during timestep
+ *  N is only visible to the consumer from timestep N+1 onwards. Producers and
+ *  consumers therefore never need to be ordered within a timestep and may
+ *  advance concurrently.
+ *
+ * Queued messages of trivially copyable types can be serialized together with
+ *  their timestep stamps, so that a checkpoint captures the messages in flight
+ *  at a timestep boundary.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added support for discarding queued messages.
+ * 19-Oct-2026  OrthogonalHawk  Serialize queued messages for checkpoints.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_CHANNEL_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_CHANNEL_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t FALCON_CHANNEL_CACHE_LINE_SIZE = 64;
+const uint32_t FALCON_CHANNEL_DEFAULT_CAPACITY = 1024;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef uint32_t FalconChannelId;
+typedef std::list<FalconChannelId> FalconChannelIdList;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+/*
+ * @brief  Bounded SPSC ring buffer of timestep-stamped messages
+ *
+ * The producer and consumer indices are kept on separate cache lines, each
+ *  next to a cached copy of the other side's index, so that the common case
+ *  of a non-full/non-empty buffer touches no shared cache line.
+ */
+template <typename T>
+class falcon_simulation_environment_ring_buffer
+{
+public:
+
+    explicit falcon_simulation_environment_ring_buffer(uint32_t capacity);
+    virtual ~falcon_simulation_environment_ring_buffer(void);
+
+    bool push(uint32_t timestep, const T &message);
+    bool pop(uint32_t current_timestep, T &message);
+    void clear(void);
+
+    uint32_t size(void) const;
+
+    bool serialize(std::vector<uint8_t> &buffer) const;
+    bool deserialize(const std::vector<uint8_t> &buffer, size_t &offset);
+
+private:
+
+    struct slot
+    {
+        uint32_t    timestep;
+        T           message;
+    };
+
+    static uint32_t round_up_to_power_of_two(uint32_t value);
+
+    bool serialize(std::vector<uint8_t> &buffer, std::true_type trivially_copyable) const;
+    bool serialize(std::vector<uint8_t> &buffer, std::false_type trivially_copyable) const;
+    bool deserialize(const std::vector<uint8_t> &buffer, size_t &offset, std::true_type trivially_copyable);
+    bool deserialize(const std::vector<uint8_t> &buffer, size_t &offset, std::false_type trivially_copyable);
+
+    std::vector<slot>        m_slots;
+    uint32_t                 m_mask;
+
+    /* consumer-owned cache line */
+    std::atomic<uint32_t>    m_head;
+    uint32_t                 m_cached_tail;
+    char                     m_consumer_pad[FALCON_CHANNEL_CACHE_LINE_SIZE];
+
+    /* producer-owned cache line */
+    std::atomic<uint32_t>    m_tail;
+    uint32_t                 m_cached_head;
+    char                     m_producer_pad[FALCON_CHANNEL_CACHE_LINE_SIZE];
+};
+
+/*
+ * @brief  Type-erased channel interface used by the channel registry
+ */
+class falcon_simulation_environment_channel_base
+{
+public:
+
+    explicit falcon_simulation_environment_channel_base(FalconChannelId id);
+    virtual ~falcon_simulation_environment_channel_base(void);
+
+    FalconChannelId get_channel_id(void) const;
+
+    virtual uint32_t get_num_producers(void) const = 0;
+    virtual bool has_consumer(void) const = 0;
+    virtual uint32_t get_queue_depth(void) const = 0;
+    virtual void clear(void) = 0;
+
+    virtual bool serialize(std::vector<uint8_t> &buffer) const = 0;
+    virtual bool deserialize(const std::vector<uint8_t> &buffer) = 0;
+
+private:
+
+    FalconChannelId    m_channel_id;
+};
+
+/*
+ * @brief  Typed MPSC channel built from one SPSC lane per producer
+ *
+ * Producers and the consumer must attach while components are being
+ *  initialized; attaching is not thread-safe and must not happen while the
+ *  simulation is stepping.
+ */
+template <typename T>
+class falcon_simulation_environment_channel : public falcon_simulation_environment_channel_base
+{
+public:
+
+    falcon_simulation_environment_channel(FalconChannelId id, uint32_t capacity);
+    virtual ~falcon_simulation_environment_channel(void);
+
+    int32_t attach_producer(void);
+    bool attach_consumer(void);
+
+    bool publish(uint32_t lane, uint32_t current_timestep, const T &message);
+    bool consume(uint32_t current_timestep, T &message);
+
+    uint32_t get_num_producers(void) const override;
+    bool has_consumer(void) const override;
+    uint32_t get_queue_depth(void) const override;
+    void clear(void) override;
+
+    bool serialize(std::vector<uint8_t> &buffer) const override;
+    bool deserialize(const std::vector<uint8_t> &buffer) override;
+
+private:
+
+    uint32_t                                                                   m_capacity;
+    std::vector<std::unique_ptr<falcon_simulation_environment_ring_buffer<T>>> m_lanes;
+    bool                                                                       m_consumer_attached;
+    uint32_t                                                                   m_next_lane;
+};
+
+/*
+ * @brief  Producer-side handle returned to components that publish on a channel
+ */
+template <typename T>
+class falcon_simulation_environment_channel_writer
+{
+public:
+
+    falcon_simulation_environment_channel_writer(void);
+    falcon_simulation_environment_channel_writer(std::shared_ptr<falcon_simulation_environment_channel<T>> channel, uint32_t lane);
+
+    bool is_valid(void) const;
+    bool publish(uint32_t current_timestep, const T &message);
+
+private:
+
+    std::shared_ptr<falcon_simulation_environment_channel<T>>    m_channel;
+    uint32_t                                                     m_lane;
+};
+
+/*
+ * @brief  Consumer-side handle returned to the component that reads a channel
+ */
+template <typename T>
+class falcon_simulation_environment_channel_reader
+{
+public:
+
+    falcon_simulation_environment_channel_reader(void);
+    explicit falcon_simulation_environment_channel_reader(std::shared_ptr<falcon_simulation_environment_channel<T>> channel);
+
+    bool is_valid(void) const;
+    bool consume(uint32_t current_timestep, T &message);
+
+private:
+
+    std::shared_ptr<falcon_simulation_environment_channel<T>>    m_channel;
+};
+
+/*
+ * @brief  Owns every channel in a simulation, keyed by channel identifier
+ *
+ * Channels are created on first request. Requesting an existing channel with
+ *  a different message type yields a null pointer.
+ */
+class falcon_simulation_environment_channel_registry
+{
+public:
+
+    falcon_simulation_environment_channel_registry(void);
+    virtual ~falcon_simulation_environment_channel_registry(void);
+
+    template <typename T>
+    std::shared_ptr<falcon_simulation_environment_channel<T>> get_channel(FalconChannelId id, uint32_t capacity);
+
+    std::shared_ptr<falcon_simulation_environment_channel_base> find_channel(FalconChannelId id);
+    FalconChannelIdList get_channel_ids(void);
+
+private:
+
+    std::map<FalconChannelId, std::shared_ptr<falcon_simulation_environment_channel_base>>    m_channels;
+};
+
+/******************************************************************************
+ *                           TEMPLATE IMPLEMENTATION
+ *****************************************************************************/
+
+template <typename T>
+falcon_simulation_environment_ring_buffer<T>::falcon_simulation_environment_ring_buffer(uint32_t capacity)
+  : m_slots(round_up_to_power_of_two(capacity)),
+    m_mask(static_cast<uint32_t>(m_slots.size()) - 1),
+    m_head(0),
+    m_cached_tail(0),
+    m_tail(0),
+    m_cached_head(0)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+falcon_simulation_environment_ring_buffer<T>::~falcon_simulation_environment_ring_buffer(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Appends a message; must only be called from the producer thread
+ *
+ * @return True if the message was queued; false if the buffer is full.
+ */
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::push(uint32_t timestep, const T &message)
+{
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cached_head > m_mask)
+    {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        if (tail - m_cached_head > m_mask)
+        {
+            return false;
+        }
+    }
+
+    slot &s = m_slots[tail & m_mask];
+    s.timestep = timestep;
+    s.message = message;
+
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+/*
+ * @brief  Removes the oldest message published before the current timestep;
+ *          must only be called from the consumer thread
+ *
+ * @return True if a message was dequeued; false otherwise.
+ */
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::pop(uint32_t current_timestep, T &message)
+{
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cached_tail)
+    {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cached_tail)
+        {
+            return false;
+        }
+    }
+
+    /* messages are pushed in timestep order, so if the oldest message was
+     *  published during the current timestep then so were all the others */
+    slot &s = m_slots[head & m_mask];
+    if (s.timestep >= current_timestep)
+    {
+        return false;
+    }
+
+    message = s.message;
+
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+/*
+ * @brief  Discards every queued message; only safe while neither the producer
+ *          nor the consumer is active
+ */
+template <typename T>
+void falcon_simulation_environment_ring_buffer<T>::clear(void)
+{
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+
+    m_head.store(tail, std::memory_order_relaxed);
+    m_cached_tail = tail;
+    m_cached_head = tail;
+}
+
+template <typename T>
+uint32_t falcon_simulation_environment_ring_buffer<T>::size(void) const
+{
+    return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+}
+
+/*
+ * @brief  Appends the queued messages and their timestep stamps to a buffer;
+ *          only safe while neither the producer nor the consumer is active
+ *
+ * @return True if the messages were serialized; false if the message type is
+ *          not trivially copyable.
+ */
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::serialize(std::vector<uint8_t> &buffer) const
+{
+    return serialize(buffer, std::is_trivially_copyable<T>());
+}
+
+/*
+ * @brief  Replaces the queued messages with those serialized at the given
+ *          buffer offset, and advances the offset past them; only safe while
+ *          neither the producer nor the consumer is active
+ *
+ * @return True if the messages were restored; false if the buffer is
+ *          truncated, holds more messages than fit, or the message type is
+ *          not trivially copyable.
+ */
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::deserialize(const std::vector<uint8_t> &buffer, size_t &offset)
+{
+    return deserialize(buffer, offset, std::is_trivially_copyable<T>());
+}
+
+template <typename T>
+uint32_t falcon_simulation_environment_ring_buffer<T>::round_up_to_power_of_two(uint32_t value)
+{
+    uint32_t ret = 1;
+    while (ret < value && ret < 0x80000000)
+    {
+        ret <<= 1;
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::serialize(std::vector<uint8_t> &buffer, std::true_type trivially_copyable) const
+{
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    const uint32_t num_messages = tail - head;
+
+    const uint8_t *count_bytes = reinterpret_cast<const uint8_t *>(&num_messages);
+    buffer.insert(buffer.end(), count_bytes, count_bytes + sizeof(num_messages));
+
+    for (uint32_t idx = head; idx != tail; ++idx)
+    {
+        const slot &s = m_slots[idx & m_mask];
+        const uint8_t *timestep_bytes = reinterpret_cast<const uint8_t *>(&s.timestep);
+        const uint8_t *message_bytes = reinterpret_cast<const uint8_t *>(&s.message);
+        buffer.insert(buffer.end(), timestep_bytes, timestep_bytes + sizeof(s.timestep));
+        buffer.insert(buffer.end(), message_bytes, message_bytes + sizeof(s.message));
+    }
+
+    return true;
+}
+
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::serialize(std::vector<uint8_t> &buffer, std::false_type trivially_copyable) const
+{
+    return false;
+}
+
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::deserialize(const std::vector<uint8_t> &buffer, size_t &offset, std::true_type trivially_copyable)
+{
+    uint32_t num_messages = 0;
+    if (offset > buffer.size() || buffer.size() - offset < sizeof(num_messages))
+    {
+        return false;
+    }
+    memcpy(&num_messages, buffer.data() + offset, sizeof(num_messages));
+    offset += sizeof(num_messages);
+
+    const size_t message_size = sizeof(uint32_t) + sizeof(T);
+    if (num_messages > m_mask + 1 || (buffer.size() - offset) / message_size < num_messages)
+    {
+        return false;
+    }
+
+    clear();
+    for (uint32_t ii = 0; ii < num_messages; ++ii)
+    {
+        uint32_t timestep = 0;
+        T message;
+        memcpy(&timestep, buffer.data() + offset, sizeof(timestep));
+        memcpy(&message, buffer.data() + offset + sizeof(timestep), sizeof(message));
+        offset += message_size;
+
+        push(timestep, message);
+    }
+
+    return true;
+}
+
+template <typename T>
+bool falcon_simulation_environment_ring_buffer<T>::deserialize(const std::vector<uint8_t> &buffer, size_t &offset, std::false_type trivially_copyable)
+{
+    return false;
+}
+
+template <typename T>
+falcon_simulation_environment_channel<T>::falcon_simulation_environment_channel(FalconChannelId id, uint32_t capacity)
+  : falcon_simulation_environment_channel_base(id),
+    m_capacity(capacity),
+    m_consumer_attached(false),
+    m_next_lane(0)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+falcon_simulation_environment_channel<T>::~falcon_simulation_environment_channel(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Allocates a dedicated lane for a new producer
+ *
+ * @return Lane index to use when publishing
+ */
+template <typename T>
+int32_t falcon_simulation_environment_channel<T>::attach_producer(void)
+{
+    m_lanes.push_back(std::unique_ptr<falcon_simulation_environment_ring_buffer<T>>(
+        new falcon_simulation_environment_ring_buffer<T>(m_capacity)));
+
+    return static_cast<int32_t>(m_lanes.size()) - 1;
+}
+
+/*
+ * @brief  Registers the single consumer for this channel
+ *
+ * @return True if no other consumer was already attached; false otherwise.
+ */
+template <typename T>
+bool falcon_simulation_environment_channel<T>::attach_consumer(void)
+{
+    if (m_consumer_attached)
+    {
+        return false;
+    }
+
+    m_consumer_attached = true;
+    return true;
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel<T>::publish(uint32_t lane, uint32_t current_timestep, const T &message)
+{
+    return m_lanes[lane]->push(current_timestep, message);
+}
+
+/*
+ * @brief  Dequeues the next message published before the current timestep
+ *
+ * Lanes are visited round-robin so that no single producer can starve the
+ *  others when the consumer only drains part of the channel each timestep.
+ */
+template <typename T>
+bool falcon_simulation_environment_channel<T>::consume(uint32_t current_timestep, T &message)
+{
+    const uint32_t num_lanes = static_cast<uint32_t>(m_lanes.size());
+
+    for (uint32_t ii = 0; ii < num_lanes; ++ii)
+    {
+        uint32_t lane = m_next_lane;
+        m_next_lane = (m_next_lane + 1 < num_lanes) ? m_next_lane + 1 : 0;
+
+        if (m_lanes[lane]->pop(current_timestep, message))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T>
+uint32_t falcon_simulation_environment_channel<T>::get_num_producers(void) const
+{
+    return static_cast<uint32_t>(m_lanes.size());
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel<T>::has_consumer(void) const
+{
+    return m_consumer_attached;
+}
+
+template <typename T>
+uint32_t falcon_simulation_environment_channel<T>::get_queue_depth(void) const
+{
+    uint32_t ret = 0;
+    for (auto &lane : m_lanes)
+    {
+        ret += lane->size();
+    }
+
+    return ret;
+}
+
+template <typename T>
+void falcon_simulation_environment_channel<T>::clear(void)
+{
+    for (auto &lane : m_lanes)
+    {
+        lane->clear();
+    }
+}
+
+/*
+ * @brief  Replaces the buffer contents with every lane's queued messages and
+ *          the consumer's round-robin position; only safe while no component
+ *          is advancing
+ *
+ * @return True if the channel was serialized; false if the message type is
+ *          not trivially copyable.
+ */
+template <typename T>
+bool falcon_simulation_environment_channel<T>::serialize(std::vector<uint8_t> &buffer) const
+{
+    const uint32_t header[] = { static_cast<uint32_t>(m_lanes.size()), m_next_lane };
+    const uint8_t *header_bytes = reinterpret_cast<const uint8_t *>(header);
+    buffer.assign(header_bytes, header_bytes + sizeof(header));
+
+    for (auto &lane : m_lanes)
+    {
+        if (!lane->serialize(buffer))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * @brief  Restores every lane from a buffer written by serialize(); only safe
+ *          while no component is advancing
+ *
+ * @return True if the channel was restored; false if the buffer is damaged or
+ *          was written for a different number of producers.
+ */
+template <typename T>
+bool falcon_simulation_environment_channel<T>::deserialize(const std::vector<uint8_t> &buffer)
+{
+    uint32_t header[2] = { 0, 0 };
+    if (buffer.size() < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(header, buffer.data(), sizeof(header));
+
+    if (header[0] != m_lanes.size() || (header[1] >= header[0] && header[1] != 0))
+    {
+        return false;
+    }
+
+    size_t offset = sizeof(header);
+    for (auto &lane : m_lanes)
+    {
+        if (!lane->deserialize(buffer, offset))
+        {
+            return false;
+        }
+    }
+
+    if (offset != buffer.size())
+    {
+        return false;
+    }
+
+    m_next_lane = header[1];
+    return true;
+}
+
+template <typename T>
+falcon_simulation_environment_channel_writer<T>::falcon_simulation_environment_channel_writer(void)
+  : m_lane(0)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+falcon_simulation_environment_channel_writer<T>::falcon_simulation_environment_channel_writer(
+    std::shared_ptr<falcon_simulation_environment_channel<T>> channel, uint32_t lane)
+  : m_channel(channel),
+    m_lane(lane)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel_writer<T>::is_valid(void) const
+{
+    return m_channel != nullptr;
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel_writer<T>::publish(uint32_t current_timestep, const T &message)
+{
+    return m_channel->publish(m_lane, current_timestep, message);
+}
+
+template <typename T>
+falcon_simulation_environment_channel_reader<T>::falcon_simulation_environment_channel_reader(void)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+falcon_simulation_environment_channel_reader<T>::falcon_simulation_environment_channel_reader(
+    std::shared_ptr<falcon_simulation_environment_channel<T>> channel)
+  : m_channel(channel)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel_reader<T>::is_valid(void) const
+{
+    return m_channel != nullptr;
+}
+
+template <typename T>
+bool falcon_simulation_environment_channel_reader<T>::consume(uint32_t current_timestep, T &message)
+{
+    return m_channel->consume(current_timestep, message);
+}
+
+template <typename T>
+std::shared_ptr<falcon_simulation_environment_channel<T>> falcon_simulation_environment_channel_registry::get_channel(FalconChannelId id, uint32_t capacity)
+{
+    auto iter = m_channels.find(id);
+    if (iter != m_channels.end())
+    {
+        return std::dynamic_pointer_cast<falcon_simulation_environment_channel<T>>(iter->second);
+    }
+
+    std::shared_ptr<falcon_simulation_environment_channel<T>> channel =
+        std::make_shared<falcon_simulation_environment_channel<T>>(id, capacity);
+    m_channels[id] = channel;
+
+    return channel;
+}
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_CHANNEL_H__
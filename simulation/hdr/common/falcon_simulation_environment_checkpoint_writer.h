@@ -0,0 +1,147 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_checkpoint_writer.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment asynchronous checkpoint writer.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a checkpoint and the background writer that stores checkpoints on
+ *  disk. The manager captures component state into a checkpoint in memory at
+ *  a timestep boundary and submits it; the writer thread then writes every
+ *  record whose contents changed since the previous checkpoint to its own
+ *  file, and commits the checkpoint by atomically renaming a manifest that
+ *  names the current file of every record:
+ *
+ *      <dir>/<prefix>checkpoint.manifest
+ *      <dir>/<prefix><record>.<timestep>.bin
+ *
+ *  A crash at any point leaves the previous manifest, and every file it
+ *  names, intact.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_CHECKPOINT_WRITER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_CHECKPOINT_WRITER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "common/falcon_simulation_environment_component.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t FALCON_CHECKPOINT_FORMAT_VERSION = 1;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/* state captured at a timestep boundary, keyed by record name */
+struct falcon_simulation_environment_checkpoint
+{
+    uint32_t                                    timestep;
+    int64_t                                     cumulative_reward;
+    std::map<std::string, FalconStateBuffer>    records;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_checkpoint_writer
+{
+public:
+
+    falcon_simulation_environment_checkpoint_writer(void);
+    virtual ~falcon_simulation_environment_checkpoint_writer(void);
+
+    bool initialize(const std::string &directory, const std::string &prefix);
+    void shutdown(void);
+
+    /* never waits for I/O; returns false, leaving the checkpoint untouched,
+     *  if the previous checkpoint is still being written */
+    bool is_busy(void);
+    bool submit(falcon_simulation_environment_checkpoint &checkpoint);
+
+    /* loads the last committed checkpoint; called before initialize() so
+     *  that the next checkpoint only writes records changed since */
+    bool load(const std::string &directory, const std::string &prefix,
+              falcon_simulation_environment_checkpoint &checkpoint);
+
+private:
+
+    /* the file holding the committed contents of a record */
+    struct record_file
+    {
+        std::string    file_name;
+        uint64_t       hash;
+        size_t         size;
+    };
+
+    void writer_thread_main(void);
+    bool write_checkpoint(const falcon_simulation_environment_checkpoint &checkpoint);
+    bool write_file(const std::string &file_name, const uint8_t *data, size_t size);
+    std::string get_path(const std::string &file_name) const;
+    std::string get_manifest_name(void) const;
+
+    std::string                                 m_directory;
+    std::string                                 m_prefix;
+
+    std::mutex                                  m_mutex;
+    std::condition_variable                     m_cv;
+    bool                                        m_busy;
+    bool                                        m_shutdown_requested;
+    falcon_simulation_environment_checkpoint    m_pending;
+    std::thread                                 m_thread;
+
+    /* only accessed by the writer thread once it is running */
+    std::map<std::string, record_file>          m_committed_files;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_CHECKPOINT_WRITER_H__
@@ -40,6 +40,16 @@
  * @section  HISTORY
  *
  * 24-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added component identifiers and inter-component
+ *                               message channels.
+ * 19-Oct-2026  OrthogonalHawk  Added previous timestep dependencies.
+ * 19-Oct-2026  OrthogonalHawk  Added component state serialization.
+ * 19-Oct-2026  OrthogonalHawk  Added observation and action buffers.
+ * 19-Oct-2026  OrthogonalHawk  Added per-trial configuration hook.
+ * 19-Oct-2026  OrthogonalHawk  Added component state metrics.
+ * 19-Oct-2026  OrthogonalHawk  Skip publishing for components without state.
+ * 19-Oct-2026  OrthogonalHawk  Components are marked once they have advanced.
+ * 19-Oct-2026  OrthogonalHawk  Components opt in to publication explicitly.
  *
  *****************************************************************************/
 
@@ -52,7 +62,13 @@
 
 #include <stdint.h>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_channel.h"
+#include "common/falcon_simulation_environment_metrics.h"
 
 /******************************************************************************
  *                                 CONSTANTS
@@ -68,6 +84,10 @@ class falcon_simulation_environment_component;
 typedef uint32_t FalconComponentId;
 typedef std::list<FalconComponentId> FalconComponentIdList;
 typedef std::list<std::shared_ptr<falcon_simulation_environment_component>> FalconComponentList;
+typedef std::vector<uint8_t> FalconStateBuffer;
+typedef float FalconObservationValue;
+typedef float FalconActionValue;
+typedef std::map<std::string, std::string> FalconTrialParameters;
 
 enum class FALCON_COMPONENT_STATUS_ENUM : uint32_t
 {
@@ -77,6 +97,7 @@ enum class FALCON_COMPONENT_STATUS_ENUM : uint32_t
     UNSUPPORTED_TIMESTEP_ADVANCE_DEPENDENCY,
     UNSUPPORTED_COMPONENT_STATE,
     UNSUPPORTED_COMPONENT_STATE_TRANSITION,
+    UNSUPPORTED_STATE_SERIALIZATION,
     FAILURE,
     NUMBER_OF_STATUS_CODES
 };
@@ -107,16 +128,41 @@ public:
     falcon_simulation_environment_component(void);
     virtual ~falcon_simulation_environment_component(void);
 
+    FalconComponentId get_component_id(void);
+
     FalconComponentIdList get_initialization_dependency_ids(void);
     FalconComponentIdList get_timestep_advance_dependency_ids(void);
+    FalconComponentIdList get_previous_timestep_dependency_ids(void);
     FalconComponentIdList get_shutdown_dependency_ids(void);
 
+    FalconChannelIdList get_input_channel_ids(void);
+    FalconChannelIdList get_output_channel_ids(void);
+
+    void attach_channel_registry(std::shared_ptr<falcon_simulation_environment_channel_registry> registry);
+
+    /* state_metric_base is the first of NUMBER_OF_STATES consecutive gauges,
+     *  one per FALCON_COMPONENT_STATE_ENUM value */
+    void attach_metrics(std::shared_ptr<falcon_simulation_environment_metrics> metrics, FalconMetricId state_metric_base);
+
     virtual FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) = 0;
+    virtual FALCON_COMPONENT_STATUS_ENUM configure_trial(uint64_t seed, const FalconTrialParameters &parameters);
     FALCON_COMPONENT_STATUS_ENUM next_timestep_started(void);
     virtual FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) = 0;
+    FALCON_COMPONENT_STATUS_ENUM timestep_advance_completed(void);
+    /* publish_timestep_state() is only called for components that return
+     *  true from uses_double_buffered_state() */
+    virtual bool uses_double_buffered_state(void) const;
+    virtual FALCON_COMPONENT_STATUS_ENUM publish_timestep_state(void);
     virtual FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) = 0;
     virtual int32_t get_timestep_reward(void) = 0;
 
+    virtual uint32_t get_observation_size(void);
+    virtual uint32_t get_action_size(void);
+    void attach_step_buffers(FalconObservationValue *observations, const FalconActionValue *actions);
+
+    virtual FALCON_COMPONENT_STATUS_ENUM serialize_state(FalconStateBuffer &buffer);
+    virtual FALCON_COMPONENT_STATUS_ENUM deserialize_state(const FalconStateBuffer &buffer);
+
     FALCON_COMPONENT_STATE_ENUM get_component_state(void);
 
     const char * get_component_state_str(FALCON_COMPONENT_STATE_ENUM state) const;
@@ -124,21 +170,97 @@ public:
 
 protected:
 
+    FALCON_COMPONENT_STATUS_ENUM set_component_id(FalconComponentId id);
+
     FALCON_COMPONENT_STATUS_ENUM set_initialization_dependencies(FalconComponentIdList &dependency_id_list);
     FALCON_COMPONENT_STATUS_ENUM set_timestep_advance_dependencies(FalconComponentIdList &dependency_id_list);
+    FALCON_COMPONENT_STATUS_ENUM set_previous_timestep_dependencies(FalconComponentIdList &dependency_id_list);
     FALCON_COMPONENT_STATUS_ENUM set_shutdown_dependencies(FalconComponentIdList &dependency_id_list);
 
+    template <typename T>
+    falcon_simulation_environment_channel_writer<T> open_output_channel(FalconChannelId id, uint32_t capacity = FALCON_CHANNEL_DEFAULT_CAPACITY);
+    template <typename T>
+    falcon_simulation_environment_channel_reader<T> open_input_channel(FalconChannelId id, uint32_t capacity = FALCON_CHANNEL_DEFAULT_CAPACITY);
+
     FALCON_COMPONENT_STATUS_ENUM transition(FALCON_COMPONENT_STATE_ENUM new_state);
 
+    FalconObservationValue * get_observation_buffer(void);
+    const FalconActionValue * get_action_buffer(void);
+
 private:
 
+    FalconComponentId              m_component_id;
     FALCON_COMPONENT_STATE_ENUM    m_component_state;
     static const char *            component_state_names[static_cast<uint32_t>(FALCON_COMPONENT_STATE_ENUM::NUMBER_OF_STATES)];
     static const char *            component_status_names[static_cast<uint32_t>(FALCON_COMPONENT_STATUS_ENUM::NUMBER_OF_STATUS_CODES)];
 
     FalconComponentIdList          m_initialization_dependency_ids;
     FalconComponentIdList          m_timestep_advance_dependency_ids;
+    FalconComponentIdList          m_previous_timestep_dependency_ids;
     FalconComponentIdList          m_shutdown_dependency_ids;
+
+    std::shared_ptr<falcon_simulation_environment_channel_registry> m_channel_registry;
+    FalconChannelIdList            m_input_channel_ids;
+    FalconChannelIdList            m_output_channel_ids;
+
+    FalconObservationValue *       m_observations;
+    const FalconActionValue *      m_actions;
+
+    std::shared_ptr<falcon_simulation_environment_metrics> m_metrics;
+    FalconMetricId                 m_state_metric_base;
 };
 
+/******************************************************************************
+ *                           TEMPLATE IMPLEMENTATION
+ *****************************************************************************/
+
+/*
+ * @brief  Opens a channel for publishing; intended to be called from initialize()
+ *
+ * @return Writer handle; invalid if no registry is attached or the channel
+ *          already exists with a different message type.
+ */
+template <typename T>
+falcon_simulation_environment_channel_writer<T> falcon_simulation_environment_component::open_output_channel(FalconChannelId id, uint32_t capacity)
+{
+    if (m_channel_registry == nullptr)
+    {
+        return falcon_simulation_environment_channel_writer<T>();
+    }
+
+    std::shared_ptr<falcon_simulation_environment_channel<T>> channel = m_channel_registry->template get_channel<T>(id, capacity);
+    if (channel == nullptr)
+    {
+        return falcon_simulation_environment_channel_writer<T>();
+    }
+
+    m_output_channel_ids.push_back(id);
+    return falcon_simulation_environment_channel_writer<T>(channel, static_cast<uint32_t>(channel->attach_producer()));
+}
+
+/*
+ * @brief  Opens a channel for consuming; intended to be called from initialize()
+ *
+ * @return Reader handle; invalid if no registry is attached, the channel
+ *          already exists with a different message type or the channel
+ *          already has a consumer.
+ */
+template <typename T>
+falcon_simulation_environment_channel_reader<T> falcon_simulation_environment_component::open_input_channel(FalconChannelId id, uint32_t capacity)
+{
+    if (m_channel_registry == nullptr)
+    {
+        return falcon_simulation_environment_channel_reader<T>();
+    }
+
+    std::shared_ptr<falcon_simulation_environment_channel<T>> channel = m_channel_registry->template get_channel<T>(id, capacity);
+    if (channel == nullptr || !channel->attach_consumer())
+    {
+        return falcon_simulation_environment_channel_reader<T>();
+    }
+
+    m_input_channel_ids.push_back(id);
+    return falcon_simulation_environment_channel_reader<T>(channel);
+}
+
 #endif // __FALCON_SIMULATION_ENVIRONMENT_COMPONENT_H__
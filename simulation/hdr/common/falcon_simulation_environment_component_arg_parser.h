@@ -42,6 +42,12 @@
  * @section  HISTORY
  *
  * 25-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added worker thread count option.
+ * 19-Oct-2026  OrthogonalHawk  Added distributed simulation options.
+ * 19-Oct-2026  OrthogonalHawk  Added scenario and parameter sweep options.
+ * 19-Oct-2026  OrthogonalHawk  Added metrics options.
+ * 19-Oct-2026  OrthogonalHawk  Added scheduling and thread pinning options.
+ * 19-Oct-2026  OrthogonalHawk  Added checkpoint options.
  *
  *****************************************************************************/
 
@@ -52,7 +58,9 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <stdint.h>
 #include <string>
+#include <vector>
 
 #include "falcon_arg_parser.h"
 
@@ -60,6 +68,11 @@
  *                                 CONSTANTS
  *****************************************************************************/
 
+const uint16_t FALCON_DEFAULT_TRANSPORT_BASE_PORT = 47000;
+const char * const FALCON_DEFAULT_SCENARIO_NAME = "empty";
+const char * const FALCON_DEFAULT_SWEEP_RESULTS_PATH = "sweep_results.tsv";
+const char * const FALCON_DEFAULT_CHECKPOINT_DIR = "checkpoints";
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
@@ -72,7 +85,7 @@
  *                              CLASS DECLARATION
  *****************************************************************************/
 
-class falcon_simulation_environment_component_arg_parser : falcon_arg_parser
+class falcon_simulation_environment_component_arg_parser : public falcon_arg_parser
 {
 public:
 
@@ -80,6 +93,27 @@ public:
     virtual ~falcon_simulation_environment_component_arg_parser(void);
 
     uint64_t get_simulation_duration_in_secs(void);
+    uint32_t get_num_worker_threads(void);
+
+    uint32_t get_rank(void);
+    uint32_t get_num_ranks(void);
+    std::vector<std::string> get_transport_hosts(void);
+    uint16_t get_transport_base_port(void);
+
+    std::string get_scenario_name(void);
+    std::string get_sweep_path(void);
+    std::string get_sweep_results_path(void);
+    uint32_t get_num_sweep_workers(void);
+
+    std::string get_metrics_socket_path(void);
+    uint32_t get_metrics_summary_interval_in_secs(void);
+
+    bool get_adaptive_schedule(void);
+    bool get_pin_threads(void);
+
+    std::string get_checkpoint_dir(void);
+    uint32_t get_checkpoint_interval_in_timesteps(void);
+    bool get_resume(void);
 
 protected:
 
@@ -88,7 +122,28 @@ protected:
 
 private:
 
-    uint64_t    m_duration;;
+    uint64_t    m_duration;
+    uint32_t    m_num_worker_threads;
+
+    uint32_t                    m_rank;
+    uint32_t                    m_num_ranks;
+    std::vector<std::string>    m_transport_hosts;
+    uint16_t                    m_transport_base_port;
+
+    std::string                 m_scenario_name;
+    std::string                 m_sweep_path;
+    std::string                 m_sweep_results_path;
+    uint32_t                    m_num_sweep_workers;
+
+    std::string                 m_metrics_socket_path;
+    uint32_t                    m_metrics_summary_interval;
+
+    bool                        m_adaptive_schedule;
+    bool                        m_pin_threads;
+
+    std::string                 m_checkpoint_dir;
+    uint32_t                    m_checkpoint_interval;
+    bool                        m_resume;
 };
 
 #endif // __FALCON_SIMULATION_ENVIRONMENT_COMPONENT_ARG_PARSER_H__
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_double_buffer.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment double-buffered component state.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a helper that components use to hold state which other components
+ *  read through previous timestep dependencies. During timestep N the owning
+ *  component writes its new state into the back buffer while dependents read
+ *  the timestep N-1 state from the front buffer; the buffers are swapped from
+ *  publish_timestep_state() once every component has advanced. Components
+ *  holding a double buffer must return true from
+ *  uses_double_buffered_state(), or they are never published.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Documented the publication opt-in.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_DOUBLE_BUFFER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_DOUBLE_BUFFER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+template <typename T>
+class falcon_simulation_environment_double_buffer
+{
+public:
+
+    falcon_simulation_environment_double_buffer(void);
+    explicit falcon_simulation_environment_double_buffer(const T &initial_state);
+    virtual ~falcon_simulation_environment_double_buffer(void);
+
+    /* state published at the end of the previous timestep; safe for
+     *  dependents to read while the owner is advancing */
+    const T & previous(void) const;
+
+    /* state being produced during the current timestep; owner access only */
+    T & current(void);
+
+    void swap(void);
+    void swap_and_retain(void);
+
+private:
+
+    T           m_buffers[2];
+    uint32_t    m_front_idx;
+};
+
+/******************************************************************************
+ *                           TEMPLATE IMPLEMENTATION
+ *****************************************************************************/
+
+template <typename T>
+falcon_simulation_environment_double_buffer<T>::falcon_simulation_environment_double_buffer(void)
+  : m_front_idx(0)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+falcon_simulation_environment_double_buffer<T>::falcon_simulation_environment_double_buffer(const T &initial_state)
+  : m_front_idx(0)
+{
+    m_buffers[0] = initial_state;
+    m_buffers[1] = initial_state;
+}
+
+template <typename T>
+falcon_simulation_environment_double_buffer<T>::~falcon_simulation_environment_double_buffer(void)
+{
+    /* no action required at this time */
+}
+
+template <typename T>
+const T & falcon_simulation_environment_double_buffer<T>::previous(void) const
+{
+    return m_buffers[m_front_idx];
+}
+
+template <typename T>
+T & falcon_simulation_environment_double_buffer<T>::current(void)
+{
+    return m_buffers[m_front_idx ^ 1];
+}
+
+/*
+ * @brief  Publishes the current state; the new back buffer holds stale state
+ *          from two timesteps ago and must be fully rewritten
+ */
+template <typename T>
+void falcon_simulation_environment_double_buffer<T>::swap(void)
+{
+    m_front_idx ^= 1;
+}
+
+/*
+ * @brief  Publishes the current state and copies it into the new back buffer
+ *          for components that update their state incrementally
+ */
+template <typename T>
+void falcon_simulation_environment_double_buffer<T>::swap_and_retain(void)
+{
+    m_front_idx ^= 1;
+    m_buffers[m_front_idx ^ 1] = m_buffers[m_front_idx];
+}
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_DOUBLE_BUFFER_H__
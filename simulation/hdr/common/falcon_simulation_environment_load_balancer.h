@@ -0,0 +1,123 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_load_balancer.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment cost-based load balancer.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a load balancer that plans which worker thread advances each
+ *  component of a wave from measured component costs. Within a wave the most
+ *  expensive component bounds the wave, so components are placed longest
+ *  first onto the least loaded thread; a component too expensive to share a
+ *  thread therefore ends up alone on one. Among threads that are nearly as
+ *  lightly loaded, a component is placed with the components it shares
+ *  dependencies with, so that their state stays in the same core's caches.
+ *
+ * Also provides the helpers used to pin worker threads to CPUs, ordered so
+ *  that consecutive threads share a NUMA node and occupy distinct physical
+ *  cores before SMT siblings are used.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added NUMA node lookup.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_LOAD_BALANCER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_LOAD_BALANCER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+#include "common/falcon_simulation_environment_component.h"
+#include "common/falcon_simulation_environment_worker_pool.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* fraction of the mean thread load a component may add beyond the least
+ *  loaded thread in order to join the components it shares dependencies with */
+const double FALCON_LOAD_BALANCER_LOCALITY_TOLERANCE = 0.10;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct falcon_load_balancer_task
+{
+    double                   cost;
+
+    /* the component itself and its dependencies; components with common
+     *  keys are co-located when balance permits */
+    FalconComponentIdList    locality_keys;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_load_balancer
+{
+public:
+
+    falcon_simulation_environment_load_balancer(void);
+    virtual ~falcon_simulation_environment_load_balancer(void);
+
+    /* starts a new plan; waves must then be planned in execution order */
+    void begin_plan(uint32_t num_threads);
+    double plan_wave(const std::vector<falcon_load_balancer_task> &tasks, FalconThreadTaskLists &assignment);
+
+    static double estimate_dynamic_makespan(const std::vector<double> &costs, uint32_t num_threads);
+    static double estimate_assigned_makespan(const std::vector<double> &costs, const FalconThreadTaskLists &assignment);
+
+    static std::vector<uint32_t> get_cpu_order(void);
+    static std::vector<uint32_t> get_cpu_nodes(const std::vector<uint32_t> &cpus);
+
+private:
+
+    uint32_t                                          m_num_threads;
+
+    /* threads holding each locality key in the plan so far */
+    std::map<FalconComponentId, std::vector<uint32_t>> m_key_threads;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_LOAD_BALANCER_H__
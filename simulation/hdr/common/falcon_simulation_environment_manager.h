@@ -39,6 +39,23 @@
  * @section  HISTORY
  *
  * 25-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added component registration, dependency-level
+ *                               scheduling and message channel support.
+ * 19-Oct-2026  OrthogonalHawk  Added double-buffered state publication.
+ * 19-Oct-2026  OrthogonalHawk  Added distributed simulation mode.
+ * 19-Oct-2026  OrthogonalHawk  Added single-step API, step buffers and
+ *                               snapshot/restore.
+ * 19-Oct-2026  OrthogonalHawk  Added per-trial configuration.
+ * 19-Oct-2026  OrthogonalHawk  Added live metrics.
+ * 19-Oct-2026  OrthogonalHawk  Added cost-based load balancing and thread
+ *                               pinning.
+ * 19-Oct-2026  OrthogonalHawk  Added asynchronous checkpoints and resume.
+ * 19-Oct-2026  OrthogonalHawk  Skip the publish batch for components without
+ *                               double-buffered state.
+ * 19-Oct-2026  OrthogonalHawk  Documented which thread is pinned as thread zero.
+ * 19-Oct-2026  OrthogonalHawk  Checkpoint readiness is reduced with the reward.
+ * 19-Oct-2026  OrthogonalHawk  Publish only components that declare double-buffered
+ *                               state.
  *
  *****************************************************************************/
 
@@ -50,15 +67,48 @@
  *****************************************************************************/
 
 #include <stdint.h>
+#include <chrono>
 #include <list>
+#include <map>
 #include <memory>
+#include <set>
+#include <vector>
 
+#include "common/falcon_simulation_environment_channel.h"
+#include "common/falcon_simulation_environment_checkpoint_writer.h"
 #include "common/falcon_simulation_environment_component.h"
+#include "common/falcon_simulation_environment_component_arg_parser.h"
+#include "common/falcon_simulation_environment_load_balancer.h"
+#include "common/falcon_simulation_environment_metrics.h"
+#include "common/falcon_simulation_environment_metrics_exporter.h"
+#include "common/falcon_simulation_environment_partitioner.h"
+#include "common/falcon_simulation_environment_transport.h"
+#include "common/falcon_simulation_environment_worker_pool.h"
 
 /******************************************************************************
  *                                 CONSTANTS
  *****************************************************************************/
 
+const uint32_t FALCON_MANAGER_TIMESTEPS_PER_SEC = 1;
+
+/* partitioning weight of a message channel edge; channels are not carried
+ *  across ranks, so their endpoints must be kept together */
+const uint32_t FALCON_MANAGER_CHANNEL_EDGE_WEIGHT = 1000000;
+
+/* minimum period over which the timestep rate metric is averaged */
+const uint32_t FALCON_MANAGER_METRICS_RATE_WINDOW_MS = 1000;
+
+/* component costs are measured on every warmup timestep and then on every
+ *  profile interval'th timestep, and smoothed with an exponentially weighted
+ *  moving average */
+const uint32_t FALCON_MANAGER_PROFILE_WARMUP_TIMESTEPS = 8;
+const uint32_t FALCON_MANAGER_PROFILE_INTERVAL = 64;
+const double FALCON_MANAGER_COST_EWMA_WEIGHT = 0.25;
+
+/* relative improvement in estimated timestep time required to replace the
+ *  current schedule once costs drift */
+const double FALCON_MANAGER_REPLAN_THRESHOLD = 0.10;
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
@@ -68,6 +118,10 @@ enum class FALCON_MANAGER_STATUS_ENUM : uint32_t
     SUCCESS = 0,
     INITIALIZATION_FAILED,
     UNSUPPORTED_TIMESTEP_ADVANCE_TIME,
+    UNSUPPORTED_COMPONENT_DEPENDENCY,
+    UNSUPPORTED_MANAGER_STATE_TRANSITION,
+    COMPONENT_FAILURE,
+    TRANSPORT_FAILURE,
     NUMBER_OF_STATUS_CODES
 };
 
@@ -80,6 +134,8 @@ enum class FALCON_MANAGER_STATE_ENUM : uint32_t
     NUMBER_OF_STATES
 };
 
+typedef std::vector<FalconComponentIdList> FalconComponentSchedule;
+
 /******************************************************************************
  *                                  MACROS
  *****************************************************************************/
@@ -95,24 +151,157 @@ public:
     falcon_simulation_environment_manager(void);
     virtual ~falcon_simulation_environment_manager(void);
 
+    FALCON_MANAGER_STATUS_ENUM add_component(std::shared_ptr<falcon_simulation_environment_component> component);
+    FALCON_MANAGER_STATUS_ENUM set_transport(std::shared_ptr<falcon_simulation_environment_transport> transport);
+
+    /* with --pin-threads 1 the calling thread is pinned as worker thread
+     *  zero, so it should be the thread that goes on to step the simulation */
     FALCON_MANAGER_STATUS_ENUM initialize(int argc, char ** pArgv);
     FALCON_MANAGER_STATUS_ENUM run_simulation(void);
+    FALCON_MANAGER_STATUS_ENUM step(void);
     FALCON_MANAGER_STATUS_ENUM shutdown(void);
 
+    FALCON_MANAGER_STATUS_ENUM configure_trial(uint64_t seed, const FalconTrialParameters &parameters);
+
+    FALCON_MANAGER_STATUS_ENUM snapshot(void);
+    FALCON_MANAGER_STATUS_ENUM restore_snapshot(void);
+
+    /* preallocated at initialize() and never reallocated, so the returned
+     *  pointers may be held for the lifetime of the manager */
+    FalconObservationValue * get_observation_buffer(size_t &num_values);
+    FalconActionValue * get_action_buffer(size_t &num_values);
+    int32_t * get_reward_buffer(size_t &num_values);
+
     FALCON_MANAGER_STATE_ENUM get_manager_state(void);
+    uint32_t get_current_timestep(void);
+    int32_t get_timestep_reward(void);
+    int64_t get_cumulative_reward(void);
 
     const char * get_manager_state_str(FALCON_MANAGER_STATE_ENUM state) const;
     const char * get_manager_status_str(FALCON_MANAGER_STATUS_ENUM status_code) const;
 
 private:
 
-    FALCON_MANAGER_STATUS_ENUM transition(FALCON_COMPONENT_STATE_ENUM new_state);
+    struct component_schedule_entry
+    {
+        std::shared_ptr<falcon_simulation_environment_component>    component;
+        FalconComponentList                                         timestep_advance_dependencies;
+        FALCON_COMPONENT_STATUS_ENUM                                status;
+
+        /* advance count; the advance time in nanoseconds follows it */
+        FalconMetricId                                              advance_metric;
+
+        /* advance time measured on profiled timesteps and its average */
+        uint64_t                                                    sampled_ns;
+        double                                                      cost_ns;
+    };
+
+    /* boundary components whose state is sent to, or received from, each
+     *  peer rank at a synchronization point */
+    struct boundary_exchange
+    {
+        std::map<FalconRank, std::set<FalconComponentId>>           outgoing;
+        std::map<FalconRank, std::set<FalconComponentId>>           incoming;
+    };
+
+    typedef FalconComponentIdList (falcon_simulation_environment_component::*FalconDependencyIdGetter)(void);
+
+    FALCON_MANAGER_STATUS_ENUM transition(FALCON_MANAGER_STATE_ENUM new_state);
+
+    FALCON_MANAGER_STATUS_ENUM compute_dependency_levels(FalconDependencyIdGetter get_dependency_ids, FalconComponentSchedule &levels);
+    FalconComponentList get_components(FalconComponentIdList ids);
+    void check_channel_endpoints(void);
+    FALCON_MANAGER_STATUS_ENUM partition_components(void);
+    void add_boundary_edges(FalconDependencyIdGetter get_dependency_ids, std::map<FalconComponentId, uint32_t> &component_waves, bool per_wave);
+    FALCON_MANAGER_STATUS_ENUM build_timestep_advance_schedule(void);
+    void allocate_step_buffers(void);
+    FALCON_MANAGER_STATUS_ENUM advance_timestep(void);
+    FALCON_MANAGER_STATUS_ENUM publish_timestep_state(void);
+    FALCON_MANAGER_STATUS_ENUM exchange_boundary_state(boundary_exchange &exchange);
+    FALCON_MANAGER_STATUS_ENUM start_metrics(void);
+    void pin_worker_threads(void);
+    void update_component_costs(void);
+    void rebalance_schedule(void);
+    void update_timestep_metrics(std::chrono::steady_clock::time_point timestep_start);
+    std::string get_metrics_summary(void);
+    FALCON_MANAGER_STATUS_ENUM start_checkpoints(void);
+    FALCON_MANAGER_STATUS_ENUM resume_from_checkpoint(void);
+    bool is_checkpoint_ready(uint32_t timestep);
+    void capture_checkpoint(void);
 
     FALCON_MANAGER_STATE_ENUM      m_manager_state;
     static const char *            manager_state_names[static_cast<uint32_t>(FALCON_MANAGER_STATE_ENUM::NUMBER_OF_STATES)];
     static const char *            manager_status_names[static_cast<uint32_t>(FALCON_MANAGER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)];
 
     FalconComponentList            m_active_components;
+    std::map<FalconComponentId, std::shared_ptr<falcon_simulation_environment_component>> m_components_by_id;
+
+    falcon_simulation_environment_component_arg_parser                m_arg_parser;
+    std::shared_ptr<falcon_simulation_environment_channel_registry>   m_channel_registry;
+    falcon_simulation_environment_worker_pool                         m_worker_pool;
+
+    /* components within a wave have no timestep advance dependencies on each
+     *  other and are advanced concurrently; waves are advanced in order */
+    std::vector<std::vector<component_schedule_entry>>                m_timestep_advance_waves;
+
+    /* threads planned to advance each wave; empty until the adaptive
+     *  schedule has been planned from measured costs */
+    bool                                                              m_adaptive_schedule;
+    falcon_simulation_environment_load_balancer                       m_load_balancer;
+    std::vector<FalconThreadTaskLists>                                m_wave_assignments;
+    uint64_t                                                          m_num_advanced_timesteps;
+
+    /* components advanced by this rank; every component unless distributed */
+    FalconComponentList            m_local_components;
+
+    /* local components that declare double-buffered state */
+    std::vector<std::shared_ptr<falcon_simulation_environment_component>> m_publish_components;
+    std::vector<FALCON_COMPONENT_STATUS_ENUM>                         m_publish_status;
+
+    std::shared_ptr<falcon_simulation_environment_transport>          m_transport;
+    FalconRank                                                        m_rank;
+    FalconComponentRankMap                                            m_component_ranks;
+    std::vector<boundary_exchange>                                    m_wave_exchanges;
+    boundary_exchange                                                 m_publish_exchange;
+
+    /* observations and actions are laid out contiguously in component
+     *  registration order; rewards hold one entry per registered component */
+    std::vector<FalconObservationValue>                               m_observations;
+    std::vector<FalconActionValue>                                    m_actions;
+    std::vector<int32_t>                                              m_component_rewards;
+    std::vector<int32_t *>                                            m_local_reward_slots;
+    /* timestep reward and the number of ranks not ready to checkpoint */
+    std::vector<int64_t>                                              m_reward_reduction;
+
+    bool                                                              m_snapshot_valid;
+    uint32_t                                                          m_snapshot_timestep;
+    int64_t                                                           m_snapshot_cumulative_reward;
+    std::map<FalconComponentId, FalconStateBuffer>                    m_snapshot_states;
+    std::vector<FalconObservationValue>                               m_snapshot_observations;
+
+    /* null unless metrics were requested on the command-line */
+    std::shared_ptr<falcon_simulation_environment_metrics>            m_metrics;
+    falcon_simulation_environment_metrics_exporter                    m_metrics_exporter;
+    FalconMetricId                                                    m_timesteps_metric;
+    FalconMetricId                                                    m_timestep_duration_metric;
+    FalconMetricId                                                    m_timestep_rate_metric;
+    FalconMetricId                                                    m_current_timestep_metric;
+    FalconMetricId                                                    m_timestep_reward_metric;
+    FalconMetricId                                                    m_cumulative_reward_metric;
+    FalconMetricId                                                    m_queue_depth_metric;
+    std::chrono::steady_clock::time_point                             m_rate_window_start;
+    uint32_t                                                          m_rate_window_timestep;
+
+    /* zero unless checkpoints were requested on the command-line; the
+     *  checkpoint buffers are swapped with the writer's and reused */
+    uint32_t                                                          m_checkpoint_interval;
+    std::string                                                       m_checkpoint_prefix;
+    falcon_simulation_environment_checkpoint_writer                   m_checkpoint_writer;
+    falcon_simulation_environment_checkpoint                          m_checkpoint;
+
+    uint32_t                       m_current_timestep;
+    int32_t                        m_timestep_reward;
+    int64_t                        m_cumulative_reward;
 };
 
 #endif // __FALCON_SIMULATION_ENVIRONMENT_MANAGER_H__
@@ -0,0 +1,199 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_metrics.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment metrics registry.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a registry of named counters and gauges for monitoring long running
+ *  simulations. Every thread that updates a metric owns a private block of
+ *  values that only it writes, so an update is a relaxed load and store on a
+ *  cache line no other writer touches; readers merge the blocks of every
+ *  thread. Metrics are rendered in the Prometheus text exposition format.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Discard updates to ids outside the registry.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_METRICS_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_METRICS_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t FALCON_METRICS_DEFAULT_CAPACITY = 256;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef uint32_t FalconMetricId;
+
+const FalconMetricId FALCON_METRICS_INVALID_ID = UINT32_MAX;
+
+enum class FALCON_METRIC_TYPE_ENUM : uint32_t
+{
+    COUNTER = 0,
+    GAUGE,
+    NUMBER_OF_TYPES
+};
+
+/* evaluated on the reading thread each time the metric is read */
+typedef std::function<double(void)> FalconMetricSampler;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_metrics
+{
+public:
+
+    explicit falcon_simulation_environment_metrics(uint32_t capacity = FALCON_METRICS_DEFAULT_CAPACITY);
+    virtual ~falcon_simulation_environment_metrics(void);
+
+    /* labels use the Prometheus syntax without braces, e.g. component="3";
+     *  metrics sharing a name must share a type and help string */
+    FalconMetricId register_counter(const std::string &name, const std::string &labels, const std::string &help);
+    FalconMetricId register_gauge(const std::string &name, const std::string &labels, const std::string &help);
+    FalconMetricId register_sampled_gauge(const std::string &name, const std::string &labels, const std::string &help,
+                                          FalconMetricSampler sampler);
+
+    /* add() may be called from any thread; set() is only meaningful for a
+     *  gauge with a single writer. Updates to FALCON_METRICS_INVALID_ID, which
+     *  a registration past capacity returns, are discarded. */
+    inline void add(FalconMetricId id, int64_t delta);
+    inline void set(FalconMetricId id, double value);
+
+    double read(FalconMetricId id);
+    std::string render_prometheus(void);
+
+private:
+
+    struct metric_descriptor
+    {
+        std::string                 name;
+        std::string                 labels;
+        std::string                 help;
+        FALCON_METRIC_TYPE_ENUM     type;
+        FalconMetricSampler         sampler;
+    };
+
+    /* the most recently used registry and value block of a thread */
+    struct thread_cache
+    {
+        uint64_t                    registry_serial;
+        std::atomic<int64_t> *      values;
+    };
+
+    FalconMetricId register_metric(const std::string &name, const std::string &labels, const std::string &help,
+                                   FALCON_METRIC_TYPE_ENUM type, FalconMetricSampler sampler);
+    std::atomic<int64_t> * get_thread_values(void);
+    std::atomic<int64_t> * create_thread_values(void);
+    double read_locked(FalconMetricId id);
+
+    static const char * metric_type_names[static_cast<uint32_t>(FALCON_METRIC_TYPE_ENUM::NUMBER_OF_TYPES)];
+    static std::atomic<uint64_t>                              next_registry_serial;
+    static thread_local thread_cache                          current_thread_cache;
+
+    const uint64_t                                            m_serial;
+    const uint32_t                                            m_capacity;
+
+    std::mutex                                                m_mutex;
+    std::vector<metric_descriptor>                            m_metrics;
+    std::unique_ptr<std::atomic<double>[]>                    m_set_values;
+    std::map<std::thread::id, std::unique_ptr<std::atomic<int64_t>[]>>    m_thread_values;
+};
+
+/******************************************************************************
+ *                            INLINE IMPLEMENTATION
+ *****************************************************************************/
+
+/*
+ * @brief  Adds delta to a counter or gauge
+ *
+ * Only the calling thread writes its block, so a relaxed load and store is
+ *  sufficient and avoids a locked read-modify-write.
+ */
+inline void falcon_simulation_environment_metrics::add(FalconMetricId id, int64_t delta)
+{
+    if (id >= m_capacity)
+    {
+        return;
+    }
+
+    std::atomic<int64_t> &value = get_thread_values()[id];
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+inline void falcon_simulation_environment_metrics::set(FalconMetricId id, double value)
+{
+    if (id >= m_capacity)
+    {
+        return;
+    }
+
+    m_set_values[id].store(value, std::memory_order_relaxed);
+}
+
+inline std::atomic<int64_t> * falcon_simulation_environment_metrics::get_thread_values(void)
+{
+    if (current_thread_cache.registry_serial == m_serial)
+    {
+        return current_thread_cache.values;
+    }
+
+    return create_thread_values();
+}
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_METRICS_H__
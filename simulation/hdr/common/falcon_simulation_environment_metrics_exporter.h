@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_metrics_exporter.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment metrics exporter.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a background exporter for a metrics registry. The exporter serves
+ *  the registry in the Prometheus text format over HTTP on a local Unix domain
+ *  socket, e.g.
+ *
+ *      curl --unix-socket /tmp/falcon.sock http://localhost/metrics
+ *
+ *  and periodically writes a one line summary to the log. All exporter work
+ *  happens on its own thread; the simulation threads only update counters.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_METRICS_EXPORTER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_METRICS_EXPORTER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "common/falcon_simulation_environment_metrics.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t FALCON_METRICS_EXPORTER_REQUEST_TIMEOUT_MS = 1000;
+const size_t FALCON_METRICS_EXPORTER_MAX_REQUEST_SIZE = 8192;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef std::function<std::string(void)> FalconMetricsSummary;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_metrics_exporter
+{
+public:
+
+    falcon_simulation_environment_metrics_exporter(void);
+    virtual ~falcon_simulation_environment_metrics_exporter(void);
+
+    /* an empty socket path disables the endpoint and a zero interval
+     *  disables the log summary */
+    bool initialize(std::shared_ptr<falcon_simulation_environment_metrics> metrics,
+                    const std::string &socket_path,
+                    uint32_t summary_interval_secs,
+                    FalconMetricsSummary summary);
+    void shutdown(void);
+
+private:
+
+    int listen_on_socket(void);
+    void exporter_thread_main(void);
+    void serve_connection(int fd);
+
+    std::shared_ptr<falcon_simulation_environment_metrics>    m_metrics;
+    std::string                                               m_socket_path;
+    uint32_t                                                  m_summary_interval_secs;
+    FalconMetricsSummary                                      m_summary;
+
+    int                                                       m_listen_fd;
+    int                                                       m_wake_fds[2];
+    std::thread                                               m_thread;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_METRICS_EXPORTER_H__
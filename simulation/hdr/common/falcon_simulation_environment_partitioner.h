@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_partitioner.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment component graph partitioner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a partitioner that splits the component dependency graph across the
+ *  ranks of a distributed simulation. Every rank runs the partitioner on the
+ *  same graph and obtains the same, deterministic assignment.
+ *
+ * Partitions are balanced by component weight, nominally the cost of
+ *  advancing the component. The manager partitions once at initialization,
+ *  before any cost has been measured, and every rank must see identical
+ *  weights, so it currently weights every component equally; a rank that
+ *  owns the expensive components is not rebalanced later.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added component weights.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_PARTITIONER_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_PARTITIONER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <map>
+
+#include "common/falcon_simulation_environment_component.h"
+#include "common/falcon_simulation_environment_transport.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* permitted partition weight above a perfectly even split */
+const double FALCON_PARTITIONER_MAX_IMBALANCE = 0.05;
+const uint32_t FALCON_PARTITIONER_MAX_REFINEMENT_PASSES = 16;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef std::map<FalconComponentId, FalconRank> FalconComponentRankMap;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_partitioner
+{
+public:
+
+    falcon_simulation_environment_partitioner(void);
+    virtual ~falcon_simulation_environment_partitioner(void);
+
+    void add_component(FalconComponentId id, uint64_t weight = 1);
+    void add_edge(FalconComponentId a, FalconComponentId b, uint32_t weight);
+
+    bool partition(uint32_t num_parts, FalconComponentRankMap &parts);
+    uint64_t get_cut_weight(const FalconComponentRankMap &parts);
+    uint64_t get_part_weight(const FalconComponentRankMap &parts, FalconRank part);
+
+private:
+
+    void grow_initial_partition(uint32_t num_parts, FalconComponentRankMap &parts);
+    uint32_t refine_partition(uint32_t num_parts, FalconComponentRankMap &parts);
+
+    /* undirected, weighted adjacency; ordered for determinism */
+    std::map<FalconComponentId, std::map<FalconComponentId, uint32_t>>    m_adjacency;
+    std::map<FalconComponentId, uint64_t>                                 m_weights;
+    uint64_t                                                              m_total_weight;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_PARTITIONER_H__
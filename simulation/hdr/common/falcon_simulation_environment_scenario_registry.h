@@ -0,0 +1,104 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_scenario_registry.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment scenario registry.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a process-wide registry of named scenarios. A scenario is a factory
+ *  that adds its components to a simulation environment manager, which lets
+ *  external drivers (language bindings, batch runners) select a scenario by
+ *  name without linking against its components directly.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_SCENARIO_REGISTRY_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_SCENARIO_REGISTRY_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+
+#include "common/falcon_simulation_environment_manager.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef std::function<FALCON_MANAGER_STATUS_ENUM(falcon_simulation_environment_manager &manager)> FalconScenarioFactory;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/* registers a scenario factory during static initialization */
+#define FALCON_REGISTER_SCENARIO(name, factory) \
+    static const bool falcon_scenario_registered_##name = \
+        falcon_simulation_environment_scenario_registry::get_instance().register_scenario(#name, factory)
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_scenario_registry
+{
+public:
+
+    static falcon_simulation_environment_scenario_registry & get_instance(void);
+
+    bool register_scenario(const std::string &name, FalconScenarioFactory factory);
+    bool has_scenario(const std::string &name);
+    std::list<std::string> get_scenario_names(void);
+
+    FALCON_MANAGER_STATUS_ENUM add_scenario_components(const std::string &name, falcon_simulation_environment_manager &manager);
+
+private:
+
+    falcon_simulation_environment_scenario_registry(void);
+    virtual ~falcon_simulation_environment_scenario_registry(void);
+
+    std::map<std::string, FalconScenarioFactory>    m_factories;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_SCENARIO_REGISTRY_H__
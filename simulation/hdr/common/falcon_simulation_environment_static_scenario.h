@@ -0,0 +1,509 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_static_scenario.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment compile-time scenario specialization.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a template facility for scenarios whose component set and
+ *  dependencies are fixed at compile time. Components are held by value, the
+ *  execution order is computed with a constexpr topological sort of the
+ *  declared dependency edges, and the step loop is expanded at compile time so
+ *  that every call is direct and can be inlined; there is no virtual dispatch
+ *  and no runtime dependency lookup.
+ *
+ * Static components are plain classes, ideally declared final, that provide:
+ *
+ *   template <typename Scenario>
+ *   FALCON_COMPONENT_STATUS_ENUM initialize(Scenario &scenario);
+ *   template <typename Scenario>
+ *   FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t current_timestep, Scenario &scenario);
+ *   template <typename Scenario>
+ *   FALCON_COMPONENT_STATUS_ENUM shutdown(Scenario &scenario);
+ *   int32_t get_timestep_reward(void);
+ *
+ *  and reach their dependencies with scenario.template get<T>(). A static
+ *  scenario joins a dynamic simulation through the static subgraph adapter,
+ *  which presents the whole scenario as a single dynamic component; static
+ *  components reach the dynamic dependencies of the subgraph through
+ *  scenario.get_dynamic_dependencies().
+ *
+ * Example:
+ *
+ *   typedef falcon_simulation_environment_static_scenario<
+ *       falcon_static_component_list<sensor, tracker, controller>,
+ *       falcon_static_dependency_list<
+ *           falcon_static_dependency<tracker, sensor>,
+ *           falcon_static_dependency<controller, tracker>>> pipeline;
+ *
+ *   manager.add_component(std::make_shared<falcon_simulation_environment_static_subgraph<pipeline>>(id));
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Shut down in reverse schedule order.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_STATIC_SCENARIO_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_STATIC_SCENARIO_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/falcon_simulation_environment_component.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+template <typename... Components>
+struct falcon_static_component_list {};
+
+/* Dependent must advance after Dependency within every timestep */
+template <typename Dependent, typename Dependency>
+struct falcon_static_dependency
+{
+    typedef Dependent     dependent;
+    typedef Dependency    dependency;
+};
+
+template <typename... Dependencies>
+struct falcon_static_dependency_list {};
+
+/* index of T within Ts; fails to compile if T is not present */
+template <typename T, typename... Ts>
+struct falcon_static_index_of;
+
+template <typename T, typename... Ts>
+struct falcon_static_index_of<T, T, Ts...> : std::integral_constant<size_t, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct falcon_static_index_of<T, U, Ts...> : std::integral_constant<size_t, 1 + falcon_static_index_of<T, Ts...>::value> {};
+
+/* arrays are oversized by one so that empty graphs remain well-formed */
+template <size_t N, size_t E>
+struct falcon_static_graph
+{
+    size_t    dependent[E + 1];
+    size_t    dependency[E + 1];
+};
+
+template <size_t N>
+struct falcon_static_schedule
+{
+    size_t    order[N + 1];
+    bool      valid;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            FUNCTION DECLARATIONS
+ *****************************************************************************/
+
+/*
+ * @brief  Orders N components so that every component follows its dependencies
+ *
+ * Evaluated at compile time. Components without a mutual ordering constraint
+ *  keep their declaration order.
+ */
+template <size_t N, size_t E>
+constexpr falcon_static_schedule<N> falcon_static_topological_sort(const falcon_static_graph<N, E> &graph)
+{
+    falcon_static_schedule<N> schedule{};
+    bool scheduled[N + 1] = {};
+    size_t num_scheduled = 0;
+    bool progress = true;
+
+    while (progress)
+    {
+        progress = false;
+
+        for (size_t ii = 0; ii < N; ++ii)
+        {
+            bool ready = !scheduled[ii];
+            for (size_t ee = 0; ee < E && ready; ++ee)
+            {
+                if (graph.dependent[ee] == ii && !scheduled[graph.dependency[ee]])
+                {
+                    ready = false;
+                }
+            }
+
+            if (ready)
+            {
+                scheduled[ii] = true;
+                schedule.order[num_scheduled++] = ii;
+                progress = true;
+            }
+        }
+    }
+
+    schedule.valid = (num_scheduled == N);
+    return schedule;
+}
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+template <typename ComponentList, typename DependencyList>
+class falcon_simulation_environment_static_scenario;
+
+template <typename... Components, typename... Dependencies>
+class falcon_simulation_environment_static_scenario<falcon_static_component_list<Components...>,
+                                                    falcon_static_dependency_list<Dependencies...>>
+{
+public:
+
+    static constexpr size_t NUM_COMPONENTS = sizeof...(Components);
+
+    falcon_simulation_environment_static_scenario(void);
+    virtual ~falcon_simulation_environment_static_scenario(void);
+
+    template <typename T>
+    T & get(void);
+
+    const FalconComponentList & get_dynamic_dependencies(void) const;
+    void set_dynamic_dependencies(const FalconComponentList &dependencies);
+    void clear_dynamic_dependencies(void);
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(void);
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t current_timestep);
+    FALCON_COMPONENT_STATUS_ENUM shutdown(void);
+    int32_t get_timestep_reward(void);
+
+private:
+
+    static constexpr falcon_static_graph<sizeof...(Components), sizeof...(Dependencies)> get_graph(void);
+    static constexpr falcon_static_schedule<sizeof...(Components)> get_schedule(void);
+
+    template <size_t I>
+    static constexpr size_t scheduled_index(void);
+
+    template <size_t... I>
+    FALCON_COMPONENT_STATUS_ENUM initialize_all(std::index_sequence<I...>);
+    template <size_t... I>
+    FALCON_COMPONENT_STATUS_ENUM advance_all(uint32_t current_timestep, std::index_sequence<I...>);
+    template <size_t... I>
+    FALCON_COMPONENT_STATUS_ENUM shutdown_all(std::index_sequence<I...>);
+    template <size_t... I>
+    int32_t reward_all(std::index_sequence<I...>);
+
+    std::tuple<Components...>        m_components;
+    const FalconComponentList *      m_dynamic_dependencies;
+    FalconComponentList              m_no_dynamic_dependencies;
+};
+
+/*
+ * @brief  Presents a static scenario to the manager as one dynamic component
+ *
+ * Dependencies between the subgraph and dynamic components are declared on
+ *  the subgraph as a whole.
+ */
+template <typename Scenario>
+class falcon_simulation_environment_static_subgraph final : public falcon_simulation_environment_component
+{
+public:
+
+    explicit falcon_simulation_environment_static_subgraph(FalconComponentId id);
+    falcon_simulation_environment_static_subgraph(FalconComponentId id,
+                                                  FalconComponentIdList initialization_dependency_ids,
+                                                  FalconComponentIdList timestep_advance_dependency_ids);
+    virtual ~falcon_simulation_environment_static_subgraph(void);
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override;
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override;
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override;
+    int32_t get_timestep_reward(void) override;
+
+    Scenario & get_scenario(void);
+
+private:
+
+    Scenario    m_scenario;
+};
+
+/******************************************************************************
+ *                           TEMPLATE IMPLEMENTATION
+ *****************************************************************************/
+
+#define FALCON_STATIC_SCENARIO_TEMPLATE \
+    template <typename... Components, typename... Dependencies>
+#define FALCON_STATIC_SCENARIO \
+    falcon_simulation_environment_static_scenario<falcon_static_component_list<Components...>, \
+                                                  falcon_static_dependency_list<Dependencies...>>
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+constexpr size_t FALCON_STATIC_SCENARIO::NUM_COMPONENTS;
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+FALCON_STATIC_SCENARIO::falcon_simulation_environment_static_scenario(void)
+  : m_dynamic_dependencies(&m_no_dynamic_dependencies)
+{
+    static_assert(get_schedule().valid, "static scenario dependencies must not be cyclic");
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+FALCON_STATIC_SCENARIO::~falcon_simulation_environment_static_scenario(void)
+{
+    /* no action required at this time */
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <typename T>
+T & FALCON_STATIC_SCENARIO::get(void)
+{
+    return std::get<falcon_static_index_of<T, Components...>::value>(m_components);
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+const FalconComponentList & FALCON_STATIC_SCENARIO::get_dynamic_dependencies(void) const
+{
+    return *m_dynamic_dependencies;
+}
+
+/*
+ * @brief  Makes the dynamic dependencies of the enclosing subgraph available
+ *          to static components; the list must outlive the current call
+ */
+FALCON_STATIC_SCENARIO_TEMPLATE
+void FALCON_STATIC_SCENARIO::set_dynamic_dependencies(const FalconComponentList &dependencies)
+{
+    m_dynamic_dependencies = &dependencies;
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+void FALCON_STATIC_SCENARIO::clear_dynamic_dependencies(void)
+{
+    m_dynamic_dependencies = &m_no_dynamic_dependencies;
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::initialize(void)
+{
+    return initialize_all(std::make_index_sequence<sizeof...(Components)>());
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::advance_timestep(uint32_t current_timestep)
+{
+    return advance_all(current_timestep, std::make_index_sequence<sizeof...(Components)>());
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::shutdown(void)
+{
+    return shutdown_all(std::make_index_sequence<sizeof...(Components)>());
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+int32_t FALCON_STATIC_SCENARIO::get_timestep_reward(void)
+{
+    return reward_all(std::make_index_sequence<sizeof...(Components)>());
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+constexpr falcon_static_graph<sizeof...(Components), sizeof...(Dependencies)> FALCON_STATIC_SCENARIO::get_graph(void)
+{
+    return falcon_static_graph<sizeof...(Components), sizeof...(Dependencies)>{
+        { falcon_static_index_of<typename Dependencies::dependent, Components...>::value..., 0 },
+        { falcon_static_index_of<typename Dependencies::dependency, Components...>::value..., 0 } };
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+constexpr falcon_static_schedule<sizeof...(Components)> FALCON_STATIC_SCENARIO::get_schedule(void)
+{
+    return falcon_static_topological_sort(get_graph());
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <size_t I>
+constexpr size_t FALCON_STATIC_SCENARIO::scheduled_index(void)
+{
+    return get_schedule().order[I];
+}
+
+/*
+ * The pack expansions below are evaluated left to right in schedule order,
+ *  except for shutdown, which walks the schedule backwards so that every
+ *  component shuts down before its dependencies; once a component fails, the
+ *  remaining components are skipped.
+ */
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <size_t... I>
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::initialize_all(std::index_sequence<I...>)
+{
+    FALCON_COMPONENT_STATUS_ENUM ret = FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    int expand[] = { 0, ((ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS) ?
+        (ret = std::get<scheduled_index<I>()>(m_components).initialize(*this), 0) : 0)... };
+    (void)expand;
+
+    return ret;
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <size_t... I>
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::advance_all(uint32_t current_timestep, std::index_sequence<I...>)
+{
+    FALCON_COMPONENT_STATUS_ENUM ret = FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    int expand[] = { 0, ((ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS) ?
+        (ret = std::get<scheduled_index<I>()>(m_components).advance_timestep(current_timestep, *this), 0) : 0)... };
+    (void)expand;
+    (void)current_timestep;
+
+    return ret;
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <size_t... I>
+FALCON_COMPONENT_STATUS_ENUM FALCON_STATIC_SCENARIO::shutdown_all(std::index_sequence<I...>)
+{
+    FALCON_COMPONENT_STATUS_ENUM ret = FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    int expand[] = { 0, ((ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS) ?
+        (ret = std::get<scheduled_index<sizeof...(I) - 1 - I>()>(m_components).shutdown(*this), 0) : 0)... };
+    (void)expand;
+
+    return ret;
+}
+
+FALCON_STATIC_SCENARIO_TEMPLATE
+template <size_t... I>
+int32_t FALCON_STATIC_SCENARIO::reward_all(std::index_sequence<I...>)
+{
+    int32_t ret = 0;
+    int expand[] = { 0, (ret += std::get<I>(m_components).get_timestep_reward(), 0)... };
+    (void)expand;
+
+    return ret;
+}
+
+#undef FALCON_STATIC_SCENARIO
+#undef FALCON_STATIC_SCENARIO_TEMPLATE
+
+template <typename Scenario>
+falcon_simulation_environment_static_subgraph<Scenario>::falcon_simulation_environment_static_subgraph(FalconComponentId id)
+{
+    set_component_id(id);
+}
+
+template <typename Scenario>
+falcon_simulation_environment_static_subgraph<Scenario>::falcon_simulation_environment_static_subgraph(
+    FalconComponentId id, FalconComponentIdList initialization_dependency_ids, FalconComponentIdList timestep_advance_dependency_ids)
+{
+    set_component_id(id);
+    set_initialization_dependencies(initialization_dependency_ids);
+    set_timestep_advance_dependencies(timestep_advance_dependency_ids);
+}
+
+template <typename Scenario>
+falcon_simulation_environment_static_subgraph<Scenario>::~falcon_simulation_environment_static_subgraph(void)
+{
+    /* no action required at this time */
+}
+
+template <typename Scenario>
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_static_subgraph<Scenario>::initialize(FalconComponentList &dependencies)
+{
+    m_scenario.set_dynamic_dependencies(dependencies);
+
+    FALCON_COMPONENT_STATUS_ENUM ret = m_scenario.initialize();
+    m_scenario.clear_dynamic_dependencies();
+    if (ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+    {
+        ret = transition(FALCON_COMPONENT_STATE_ENUM::INITIALIZED);
+    }
+
+    return ret;
+}
+
+template <typename Scenario>
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_static_subgraph<Scenario>::advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies)
+{
+    m_scenario.set_dynamic_dependencies(dependencies);
+
+    FALCON_COMPONENT_STATUS_ENUM ret = m_scenario.advance_timestep(current_timestep);
+    m_scenario.clear_dynamic_dependencies();
+    if (ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+    {
+        ret = transition(FALCON_COMPONENT_STATE_ENUM::TIMESTEP_ADVANCED);
+    }
+
+    return ret;
+}
+
+template <typename Scenario>
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_static_subgraph<Scenario>::shutdown(FalconComponentList &dependencies)
+{
+    m_scenario.set_dynamic_dependencies(dependencies);
+
+    FALCON_COMPONENT_STATUS_ENUM ret = m_scenario.shutdown();
+    m_scenario.clear_dynamic_dependencies();
+    if (ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+    {
+        ret = transition(FALCON_COMPONENT_STATE_ENUM::SHUTDOWN_COMPLETE);
+    }
+
+    return ret;
+}
+
+template <typename Scenario>
+int32_t falcon_simulation_environment_static_subgraph<Scenario>::get_timestep_reward(void)
+{
+    return m_scenario.get_timestep_reward();
+}
+
+/*
+ * @brief  Gives dynamic components that depend on the subgraph typed access to
+ *          its static components
+ */
+template <typename Scenario>
+Scenario & falcon_simulation_environment_static_subgraph<Scenario>::get_scenario(void)
+{
+    return m_scenario;
+}
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_STATIC_SCENARIO_H__
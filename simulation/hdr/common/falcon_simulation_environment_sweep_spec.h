@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_sweep_spec.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment parameter sweep specification.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines the parameter sweep specification used by the batch runner. A sweep
+ *  file is a list of "key = value[, value...]" lines; '#' starts a comment:
+ *
+ *      scenario    = empty            # one or more registered scenarios
+ *      duration    = 3600             # seconds simulated by every trial
+ *      seeds       = 1-1000, 2000     # seeds and inclusive seed ranges
+ *      param.speed = 1.0, 2.0, 4.0    # passed to configure_trial()
+ *
+ * The sweep expands to one trial per combination of scenario, parameter
+ *  values and seed, and is rejected if that exceeds FALCON_SWEEP_MAX_TRIALS. Trials are numbered in a fixed order, scenario-major so
+ *  that consecutive trials share a scenario, which lets the batch runner keep
+ *  its trial numbering stable across resumed runs.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Bounded the number of trials.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_SWEEP_SPEC_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_SWEEP_SPEC_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/falcon_simulation_environment_component.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const char * const FALCON_SWEEP_PARAMETER_PREFIX = "param.";
+
+/* bounds the expanded sweep, and with it every seed range */
+const uint64_t FALCON_SWEEP_MAX_TRIALS = 1000000;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef uint32_t FalconTrialId;
+
+struct falcon_simulation_environment_sweep_trial
+{
+    FalconTrialId            trial_id;
+    std::string              scenario_name;
+    uint64_t                 seed;
+    uint64_t                 duration_in_secs;
+    FalconTrialParameters    parameters;
+};
+
+typedef std::vector<falcon_simulation_environment_sweep_trial> FalconSweepTrialList;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_sweep_spec
+{
+public:
+
+    falcon_simulation_environment_sweep_spec(void);
+    virtual ~falcon_simulation_environment_sweep_spec(void);
+
+    bool load(const std::string &path);
+    bool parse(std::istream &input);
+
+    const FalconSweepTrialList & get_trials(void) const;
+
+    /* identifies the expanded trial list so that a results file written for
+     *  a different sweep is never resumed */
+    uint64_t get_fingerprint(void) const;
+
+    static std::string format_parameters(const FalconTrialParameters &parameters);
+
+private:
+
+    bool parse_line(const std::string &line, uint32_t line_number);
+    bool parse_seeds(const std::vector<std::string> &values);
+    void expand_trials(void);
+
+    std::vector<std::string>                                           m_scenario_names;
+    uint64_t                                                           m_duration_in_secs;
+    std::vector<uint64_t>                                              m_seeds;
+    std::vector<std::pair<std::string, std::vector<std::string>>>      m_parameters;
+
+    FalconSweepTrialList                                               m_trials;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_SWEEP_SPEC_H__
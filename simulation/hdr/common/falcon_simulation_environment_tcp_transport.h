@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_tcp_transport.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment TCP transport.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a transport that connects every pair of ranks with a TCP socket.
+ *  Rank N listens on base_port + N, so several ranks may share one host; on a
+ *  single machine every rank simply uses the loopback address.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_TCP_TRANSPORT_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_TCP_TRANSPORT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_transport.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t FALCON_TCP_TRANSPORT_CONNECT_TIMEOUT_MS = 30000;
+const uint32_t FALCON_TCP_TRANSPORT_IO_TIMEOUT_MS = 60000;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_tcp_transport : public falcon_simulation_environment_transport
+{
+public:
+
+    falcon_simulation_environment_tcp_transport(FalconRank rank, const std::vector<std::string> &hosts, uint16_t base_port);
+    virtual ~falcon_simulation_environment_tcp_transport(void);
+
+    bool initialize(void) override;
+    void shutdown(void) override;
+
+    FalconRank get_rank(void) const override;
+    uint32_t get_num_ranks(void) const override;
+
+    bool exchange(const FalconRankBufferMap &outgoing, FalconRankBufferMap &incoming) override;
+
+private:
+
+    int listen_for_peers(void);
+    int connect_to_peer(FalconRank peer);
+    bool configure_peer_socket(int fd);
+
+    FalconRank                  m_rank;
+    std::vector<std::string>    m_hosts;
+    uint16_t                    m_base_port;
+
+    /* indexed by rank; -1 for this rank */
+    std::vector<int>            m_peer_fds;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_TCP_TRANSPORT_H__
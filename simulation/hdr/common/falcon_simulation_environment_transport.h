@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_transport.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment inter-process transport interface.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines the abstract interface used by the simulation environment manager
+ *  to exchange boundary component state between the processes ("ranks") of a
+ *  distributed simulation and to coordinate global timestep barriers and
+ *  reward reductions. Concrete transports derive from this class.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_TRANSPORT_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_TRANSPORT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef uint32_t FalconRank;
+typedef std::vector<uint8_t> FalconTransportBuffer;
+typedef std::map<FalconRank, FalconTransportBuffer> FalconRankBufferMap;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_transport
+{
+public:
+
+    falcon_simulation_environment_transport(void);
+    virtual ~falcon_simulation_environment_transport(void);
+
+    virtual bool initialize(void) = 0;
+    virtual void shutdown(void) = 0;
+
+    virtual FalconRank get_rank(void) const = 0;
+    virtual uint32_t get_num_ranks(void) const = 0;
+
+    /*
+     * Sends every outgoing buffer to its keyed peer and, concurrently, receives
+     *  one buffer from every peer keyed in incoming. Both sides of a peer pair
+     *  must agree on whether a message is exchanged.
+     */
+    virtual bool exchange(const FalconRankBufferMap &outgoing, FalconRankBufferMap &incoming) = 0;
+
+    bool all_reduce_sum(std::vector<int64_t> &values);
+    bool barrier(void);
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_TRANSPORT_H__
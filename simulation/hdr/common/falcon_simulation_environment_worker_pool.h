@@ -0,0 +1,163 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_worker_pool.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment worker thread pool.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a persistent pool of worker threads used by the simulation
+ *  environment manager to advance independent components concurrently. The
+ *  pool executes one batch of tasks at a time; the calling thread joins in
+ *  and the call returns once every task in the batch has completed.
+ *
+ * Tasks are either claimed dynamically in index order, or assigned to
+ *  threads in advance; a thread that finishes its assigned tasks steals the
+ *  remaining tasks of the other threads in its steal group. Once threads are
+ *  pinned, grouping them by NUMA node keeps stolen tasks, and the component
+ *  state they touch, on the node the assignment placed them on.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added queue depth for metrics.
+ * 19-Oct-2026  OrthogonalHawk  Added assigned tasks and CPU affinity.
+ * 19-Oct-2026  OrthogonalHawk  Fixed stale batches after re-initialization.
+ * 19-Oct-2026  OrthogonalHawk  Added steal groups.
+ * 19-Oct-2026  OrthogonalHawk  Queue depth is read without the pool mutex.
+ * 19-Oct-2026  OrthogonalHawk  Restore the caller's CPU affinity on shutdown.
+ *
+ *****************************************************************************/
+
+#ifndef __FALCON_SIMULATION_ENVIRONMENT_WORKER_POOL_H__
+#define __FALCON_SIMULATION_ENVIRONMENT_WORKER_POOL_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef std::function<void(uint32_t task_idx)> FalconWorkerTask;
+
+/* task indices for each thread, in execution order; thread zero is the
+ *  thread calling parallel_for_assigned() */
+typedef std::vector<std::vector<uint32_t>> FalconThreadTaskLists;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_environment_worker_pool
+{
+public:
+
+    falcon_simulation_environment_worker_pool(void);
+    virtual ~falcon_simulation_environment_worker_pool(void);
+
+    bool initialize(uint32_t num_threads);
+    void parallel_for(uint32_t num_tasks, const FalconWorkerTask &task);
+    void parallel_for_assigned(const FalconThreadTaskLists &assignment, const FalconWorkerTask &task);
+    void shutdown(void);
+
+    bool pin_threads(const std::vector<uint32_t> &cpus);
+    void set_steal_groups(const std::vector<uint32_t> &thread_groups);
+
+    uint32_t get_num_threads(void) const;
+    uint32_t get_queue_depth(void);
+
+private:
+
+    /* claim position and length of one assigned task list */
+    struct assigned_list_cursor
+    {
+        std::atomic<uint32_t>    next_idx;
+        std::atomic<uint32_t>    num_tasks;
+    };
+
+    void dispatch(const FalconWorkerTask &task, uint32_t num_tasks, const FalconThreadTaskLists *assignment);
+    void worker_thread_main(uint32_t thread_idx, uint64_t start_generation);
+    void execute_tasks(uint32_t thread_idx);
+    void restore_caller_affinity(void);
+
+    std::vector<std::thread>    m_threads;
+    std::mutex                  m_mutex;
+    std::condition_variable     m_start_cv;
+    std::condition_variable     m_done_cv;
+    uint64_t                    m_generation;
+    uint32_t                    m_active_workers;
+    bool                        m_shutdown_requested;
+
+    const FalconWorkerTask *    m_task;
+    uint32_t                    m_num_tasks;
+    std::atomic<uint32_t>       m_next_task_idx;
+
+    /* size of the current batch, published for get_queue_depth() so that it
+     *  never takes the mutex; zero between batches */
+    std::atomic<uint32_t>       m_num_dispatched_tasks;
+    std::atomic<uint32_t>       m_num_dispatched_lists;
+
+    /* cursor buffers only grow and are kept for the lifetime of the pool, so
+     *  get_queue_depth() never reads a freed buffer */
+    const FalconThreadTaskLists *                           m_assignment;
+    std::vector<std::unique_ptr<assigned_list_cursor[]>>    m_cursor_buffers;
+    std::atomic<assigned_list_cursor *>                     m_cursors;
+    size_t                                                  m_num_cursors;
+    std::vector<uint32_t>                       m_steal_groups;
+
+    /* the thread pinned as thread zero belongs to the caller, so its original
+     *  affinity is restored by shutdown() */
+    bool                        m_caller_pinned;
+    pthread_t                   m_pinned_caller;
+    cpu_set_t                   m_caller_cpu_set;
+};
+
+#endif // __FALCON_SIMULATION_ENVIRONMENT_WORKER_POOL_H__
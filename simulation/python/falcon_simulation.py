@@ -0,0 +1,200 @@
+###############################################################################
+#
+# MIT License
+#
+# Copyright (c) 2018 OrthogonalHawk
+#
+# See the LICENSE file at the root of this repository for the full text.
+#
+###############################################################################
+
+"""Thin Python binding for the FALCON Simulation Environment C interface.
+
+Observation, action and reward arrays are views over buffers owned by the
+simulation environment manager; nothing is copied or serialized on the step
+path. NumPy arrays are returned when NumPy is installed, otherwise memoryviews.
+
+Example:
+
+    with FalconSimulation("my_scenario") as sim:
+        sim.initialize(threads=4)
+        sim.snapshot()
+        for _ in range(1000):
+            sim.actions[:] = policy(sim.observations)
+            rewards = sim.step()
+        sim.reset()
+
+Run this module directly to measure the fixed per-step overhead:
+
+    python3 falcon_simulation.py --scenario empty --steps 100000
+"""
+
+import argparse
+import ctypes
+import os
+import time
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+DEFAULT_LIBRARY = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "..", "lib", "libfalcon_simulation.so")
+
+
+class FalconSimulationError(RuntimeError):
+    pass
+
+
+def _load_library(path):
+    lib = ctypes.CDLL(path)
+    handle = ctypes.c_void_p
+    size_ptr = ctypes.POINTER(ctypes.c_size_t)
+
+    signatures = {
+        "falcon_simulation_create": (handle, [ctypes.c_char_p]),
+        "falcon_simulation_destroy": (None, [handle]),
+        "falcon_simulation_initialize": (ctypes.c_int, [handle, ctypes.c_int, ctypes.POINTER(ctypes.c_char_p)]),
+        "falcon_simulation_step": (ctypes.c_int, [handle]),
+        "falcon_simulation_snapshot": (ctypes.c_int, [handle]),
+        "falcon_simulation_reset": (ctypes.c_int, [handle]),
+        "falcon_simulation_shutdown": (ctypes.c_int, [handle]),
+        "falcon_simulation_get_observations": (ctypes.POINTER(ctypes.c_float), [handle, size_ptr]),
+        "falcon_simulation_get_actions": (ctypes.POINTER(ctypes.c_float), [handle, size_ptr]),
+        "falcon_simulation_get_rewards": (ctypes.POINTER(ctypes.c_int32), [handle, size_ptr]),
+        "falcon_simulation_get_timestep_reward": (ctypes.c_int32, [handle]),
+        "falcon_simulation_get_cumulative_reward": (ctypes.c_int64, [handle]),
+        "falcon_simulation_get_current_timestep": (ctypes.c_uint32, [handle]),
+        "falcon_simulation_get_status_str": (ctypes.c_char_p, [handle, ctypes.c_int]),
+    }
+
+    for name, (restype, argtypes) in signatures.items():
+        function = getattr(lib, name)
+        function.restype = restype
+        function.argtypes = argtypes
+
+    return lib
+
+
+class FalconSimulation(object):
+
+    def __init__(self, scenario, library=None):
+        path = library or os.environ.get("FALCON_SIMULATION_LIBRARY", DEFAULT_LIBRARY)
+        self._lib = _load_library(path)
+        self._handle = self._lib.falcon_simulation_create(scenario.encode())
+        if not self._handle:
+            raise FalconSimulationError("unknown scenario '%s'" % scenario)
+
+        self.observations = None
+        self.actions = None
+        self.rewards = None
+
+        # bound once so that step() does a single attribute lookup
+        self._step = self._lib.falcon_simulation_step
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc_info):
+        self.close()
+
+    def __del__(self):
+        self.close()
+
+    def _check(self, status):
+        if status != 0:
+            message = self._lib.falcon_simulation_get_status_str(self._handle, status)
+            raise FalconSimulationError(message.decode() if message else "status %d" % status)
+
+    def _view(self, getter, ctype, format):
+        count = ctypes.c_size_t(0)
+        pointer = getter(self._handle, ctypes.byref(count))
+        buffer = (ctype * count.value).from_address(ctypes.addressof(pointer.contents)) if count.value else (ctype * 0)()
+
+        if numpy is not None:
+            return numpy.ctypeslib.as_array(buffer)
+
+        # ctypes exports an endian-qualified format that memoryview cannot
+        # assign through, so recast to the native single-character format
+        return memoryview(buffer).cast("B").cast(format)
+
+    def initialize(self, **options):
+        """Initializes the scenario; options map to command-line arguments,
+        e.g. threads=4 becomes --threads 4."""
+        args = []
+        for name, value in options.items():
+            args += ["--" + name.replace("_", "-"), str(value)]
+
+        argv = (ctypes.c_char_p * len(args))(*[arg.encode() for arg in args])
+        self._check(self._lib.falcon_simulation_initialize(self._handle, len(args), argv))
+
+        self.observations = self._view(self._lib.falcon_simulation_get_observations, ctypes.c_float, "f")
+        self.actions = self._view(self._lib.falcon_simulation_get_actions, ctypes.c_float, "f")
+        self.rewards = self._view(self._lib.falcon_simulation_get_rewards, ctypes.c_int32, "i")
+
+    def step(self, actions=None):
+        """Advances one timestep and returns the per-component reward view.
+        Writing into self.actions directly avoids copying the actions."""
+        if actions is not None:
+            if numpy is not None:
+                self.actions[:] = actions
+            else:
+                for index, value in enumerate(actions):
+                    self.actions[index] = value
+
+        status = self._step(self._handle)
+        if status != 0:
+            self._check(status)
+
+        return self.rewards
+
+    def snapshot(self):
+        self._check(self._lib.falcon_simulation_snapshot(self._handle))
+
+    def reset(self):
+        self._check(self._lib.falcon_simulation_reset(self._handle))
+
+    @property
+    def timestep(self):
+        return self._lib.falcon_simulation_get_current_timestep(self._handle)
+
+    @property
+    def timestep_reward(self):
+        return self._lib.falcon_simulation_get_timestep_reward(self._handle)
+
+    @property
+    def cumulative_reward(self):
+        return self._lib.falcon_simulation_get_cumulative_reward(self._handle)
+
+    def close(self):
+        handle = getattr(self, "_handle", None)
+        if handle:
+            self._lib.falcon_simulation_shutdown(handle)
+            self._lib.falcon_simulation_destroy(handle)
+            self._handle = None
+
+
+def benchmark(scenario, steps, library=None, **options):
+    """Returns the mean wall-clock time of step() in microseconds."""
+    with FalconSimulation(scenario, library) as sim:
+        sim.initialize(**options)
+
+        start = time.perf_counter()
+        for _ in range(steps):
+            sim.step()
+        elapsed = time.perf_counter() - start
+
+    return elapsed * 1e6 / steps
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Measure FALCON simulation per-step overhead")
+    parser.add_argument("--library", default=None)
+    parser.add_argument("--scenario", default="empty")
+    parser.add_argument("--steps", type=int, default=100000)
+    parser.add_argument("--threads", type=int, default=1)
+    args = parser.parse_args()
+
+    usec = benchmark(args.scenario, args.steps, args.library, threads=args.threads)
+    print("%s: %.3f usec/step over %d steps" % (args.scenario, usec, args.steps))
@@ -0,0 +1,736 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_batch_runner.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment parameter sweep batch runner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the parameter sweep batch runner. The parent process forks the
+ *  worker processes before it creates any threads or managers, hands each
+ *  worker a trial id over its command pipe and waits on the result pipes with
+ *  poll(). Closing a command pipe tells the worker that no trials remain.
+ *  A worker is known to have exited when its result pipe reports EOF; it is
+ *  reaped there and, while trials remain, replaced by a new process.
+ *
+ * Results are tab-separated, one line per trial:
+ *
+ *      trial_id scenario seed parameters status timesteps cumulative_reward elapsed_secs
+ *
+ *  A trial rerun after a resume appends a new line that supersedes the
+ *  earlier one.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Replace exited workers and retry their trials.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_batch_runner.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const size_t RESULT_READ_SIZE = 4096;
+static const size_t RESULT_STATUS_FIELD = 4;
+
+/* scenario managers in worker processes are single threaded; the sweep is
+ *  parallelized across processes instead */
+static const char * const WORKER_MANAGER_ARGS[] = { "falcon_simulation", "--threads", "1" };
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static bool write_fully(int fd, const void *data, size_t len)
+{
+    const uint8_t *ptr = static_cast<const uint8_t *>(data);
+    while (len > 0)
+    {
+        ssize_t ret = write(fd, ptr, len);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            return false;
+        }
+
+        ptr += ret;
+        len -= ret;
+    }
+
+    return true;
+}
+
+static bool read_fully(int fd, void *data, size_t len)
+{
+    uint8_t *ptr = static_cast<uint8_t *>(data);
+    while (len > 0)
+    {
+        ssize_t ret = read(fd, ptr, len);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            return false;
+        }
+
+        ptr += ret;
+        len -= ret;
+    }
+
+    return true;
+}
+
+static std::vector<std::string> split_fields(const std::string &line)
+{
+    std::vector<std::string> ret;
+    std::stringstream ss(line);
+    std::string field;
+
+    while (std::getline(ss, field, '\t'))
+    {
+        ret.push_back(field);
+    }
+
+    return ret;
+}
+
+static std::string format_result(const falcon_simulation_environment_sweep_trial &trial, const char *status,
+                                 uint64_t num_timesteps, int64_t cumulative_reward, double elapsed_secs)
+{
+    std::stringstream ss;
+    ss.precision(6);
+    ss << trial.trial_id << '\t' << trial.scenario_name << '\t' << trial.seed << '\t'
+       << falcon_simulation_environment_sweep_spec::format_parameters(trial.parameters) << '\t'
+       << status << '\t' << num_timesteps << '\t' << cumulative_reward << '\t'
+       << std::fixed << elapsed_secs;
+
+    return ss.str();
+}
+
+static std::string format_header(uint64_t fingerprint)
+{
+    char header[64];
+    snprintf(header, sizeof(header), "# falcon_simulation sweep %016" PRIx64, fingerprint);
+
+    return header;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+/* must be kept in sync with FALCON_BATCH_RUNNER_STATUS_ENUM */
+const char * falcon_simulation_environment_batch_runner::batch_runner_status_names[static_cast<uint32_t>(FALCON_BATCH_RUNNER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)] =
+{
+    "SUCCESS",
+    "INVALID_RESULTS_FILE",
+    "WORKER_FAILURE",
+    "TRIAL_FAILURE"
+};
+
+falcon_simulation_environment_batch_runner::falcon_simulation_environment_batch_runner(void)
+  : m_trials(nullptr),
+    m_results_file(nullptr),
+    m_num_recorded(0),
+    m_num_failed(0)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_batch_runner::~falcon_simulation_environment_batch_runner(void)
+{
+    if (m_results_file != nullptr)
+    {
+        fclose(m_results_file);
+    }
+}
+
+/*
+ * @brief  Runs every trial of the sweep that has not already completed
+ *          successfully according to the results file
+ *
+ * @param[in] spec          Parsed sweep specification.
+ * @param[in] results_path  Results file; created if it does not exist.
+ * @param[in] num_workers   Number of worker processes; zero selects one per
+ *                           hardware thread.
+ *
+ * Must be called before the calling process creates any threads.
+ */
+FALCON_BATCH_RUNNER_STATUS_ENUM falcon_simulation_environment_batch_runner::run(const falcon_simulation_environment_sweep_spec &spec,
+                                                                                const std::string &results_path,
+                                                                                uint32_t num_workers)
+{
+    m_trials = &spec.get_trials();
+    m_num_recorded = 0;
+    m_num_failed = 0;
+
+    FALCON_BATCH_RUNNER_STATUS_ENUM ret = open_results_file(results_path, spec.get_fingerprint());
+    if (ret != FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    m_pending_trials.clear();
+    m_trial_attempts.clear();
+    for (auto &trial : *m_trials)
+    {
+        if (m_completed_trials.count(trial.trial_id) == 0)
+        {
+            m_pending_trials.push_back(trial.trial_id);
+        }
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Sweep has " << m_trials->size() << " trial(s); " << m_completed_trials.size()
+                            << " already completed, " << m_pending_trials.size() << " remaining";
+
+    if (m_pending_trials.empty())
+    {
+        return ret;
+    }
+
+    if (num_workers == 0)
+    {
+        num_workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_workers = std::min(num_workers, static_cast<uint32_t>(m_pending_trials.size()));
+
+    /* a worker that exits early must not take the parent down with SIGPIPE */
+    signal(SIGPIPE, SIG_IGN);
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    m_workers.clear();
+    m_workers.reserve(num_workers);
+    for (uint32_t ii = 0; ii < num_workers; ++ii)
+    {
+        worker_process worker;
+        if (!spawn_worker(worker))
+        {
+            ret = FALCON_BATCH_RUNNER_STATUS_ENUM::WORKER_FAILURE;
+            break;
+        }
+
+        m_workers.push_back(worker);
+        dispatch_next_trial(m_workers.back());
+    }
+
+    std::vector<struct pollfd> poll_fds;
+    std::vector<size_t> poll_workers;
+    do
+    {
+        poll_fds.clear();
+        poll_workers.clear();
+        for (size_t ii = 0; ii < m_workers.size(); ++ii)
+        {
+            if (m_workers[ii].result_fd >= 0)
+            {
+                poll_fds.push_back({ m_workers[ii].result_fd, POLLIN, 0 });
+                poll_workers.push_back(ii);
+            }
+        }
+
+        if (poll_fds.empty() || (poll(poll_fds.data(), poll_fds.size(), -1) < 0 && errno != EINTR))
+        {
+            break;
+        }
+
+        for (size_t ii = 0; ii < poll_fds.size(); ++ii)
+        {
+            if (poll_fds[ii].revents != 0)
+            {
+                collect_worker_output(m_workers[poll_workers[ii]]);
+            }
+        }
+    } while (true);
+
+    for (auto &worker : m_workers)
+    {
+        if (worker.pid > 0)
+        {
+            int status = 0;
+            waitpid(worker.pid, &status, 0);
+        }
+    }
+    m_workers.clear();
+
+    fclose(m_results_file);
+    m_results_file = nullptr;
+
+    double elapsed_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    BOOST_LOG_TRIVIAL(info) << "Sweep recorded " << m_num_recorded << " trial(s) (" << m_num_failed << " failed) in "
+                            << elapsed_secs << " sec using " << num_workers << " worker(s); "
+                            << (elapsed_secs > 0.0 ? m_num_recorded * 3600.0 / elapsed_secs : 0.0) << " trials/hour";
+
+    if (!m_pending_trials.empty())
+    {
+        BOOST_LOG_TRIVIAL(error) << m_pending_trials.size() << " trial(s) were not run; rerun the sweep to resume";
+        ret = FALCON_BATCH_RUNNER_STATUS_ENUM::WORKER_FAILURE;
+    }
+    else if (ret == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS && m_num_failed > 0)
+    {
+        ret = FALCON_BATCH_RUNNER_STATUS_ENUM::TRIAL_FAILURE;
+    }
+
+    return ret;
+}
+
+const char * falcon_simulation_environment_batch_runner::get_batch_runner_status_str(FALCON_BATCH_RUNNER_STATUS_ENUM status_code) const
+{
+    if (status_code < FALCON_BATCH_RUNNER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)
+    {
+        return batch_runner_status_names[static_cast<uint32_t>(status_code)];
+    }
+
+    return nullptr;
+}
+
+/*
+ * @brief  Opens the results file for appending, first loading the trials that
+ *          already completed successfully if the file exists
+ *
+ * A partially written final line, left behind if the previous run was killed,
+ *  is discarded so that the trial is run again.
+ */
+FALCON_BATCH_RUNNER_STATUS_ENUM falcon_simulation_environment_batch_runner::open_results_file(const std::string &results_path,
+                                                                                              uint64_t fingerprint)
+{
+    std::string header = format_header(fingerprint);
+    std::string contents;
+
+    m_completed_trials.clear();
+
+    std::ifstream existing(results_path, std::ios::binary);
+    if (existing.is_open())
+    {
+        contents.assign(std::istreambuf_iterator<char>(existing), std::istreambuf_iterator<char>());
+        existing.close();
+    }
+
+    size_t last_newline = contents.rfind('\n');
+    contents.resize(last_newline == std::string::npos ? 0 : last_newline + 1);
+
+    std::stringstream lines(contents);
+    std::string line;
+    if (std::getline(lines, line) && line != header)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Results file " << results_path << " was written for a different sweep";
+        return FALCON_BATCH_RUNNER_STATUS_ENUM::INVALID_RESULTS_FILE;
+    }
+
+    while (std::getline(lines, line))
+    {
+        std::vector<std::string> fields = split_fields(line);
+        if (!line.empty() && line[0] != '#' && fields.size() > RESULT_STATUS_FIELD &&
+            fields[RESULT_STATUS_FIELD] == "SUCCESS")
+        {
+            m_completed_trials.insert(static_cast<FalconTrialId>(strtoul(fields[0].c_str(), nullptr, 10)));
+        }
+    }
+
+    if (truncate(results_path.c_str(), contents.size()) != 0 && errno != ENOENT)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to truncate results file " << results_path;
+        return FALCON_BATCH_RUNNER_STATUS_ENUM::INVALID_RESULTS_FILE;
+    }
+
+    m_results_file = fopen(results_path.c_str(), "a");
+    if (m_results_file == nullptr)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to open results file " << results_path;
+        return FALCON_BATCH_RUNNER_STATUS_ENUM::INVALID_RESULTS_FILE;
+    }
+
+    if (contents.empty())
+    {
+        record_result(header);
+        record_result("# trial_id\tscenario\tseed\tparameters\tstatus\ttimesteps\tcumulative_reward\telapsed_secs");
+    }
+
+    return FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS;
+}
+
+bool falcon_simulation_environment_batch_runner::spawn_worker(worker_process &worker)
+{
+    int command_pipe[2];
+    int result_pipe[2];
+
+    if (pipe(command_pipe) != 0)
+    {
+        return false;
+    }
+
+    if (pipe(result_pipe) != 0)
+    {
+        close(command_pipe[0]);
+        close(command_pipe[1]);
+        return false;
+    }
+
+    /* buffered output would otherwise be written once by each process */
+    fflush(nullptr);
+
+    worker.pid = fork();
+    if (worker.pid < 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to fork sweep worker process";
+        close(command_pipe[0]);
+        close(command_pipe[1]);
+        close(result_pipe[0]);
+        close(result_pipe[1]);
+        return false;
+    }
+
+    if (worker.pid == 0)
+    {
+        close(command_pipe[1]);
+        close(result_pipe[0]);
+
+        /* holding the pipes of earlier workers open would hide their EOF */
+        for (auto &sibling : m_workers)
+        {
+            if (sibling.command_fd >= 0)
+            {
+                close(sibling.command_fd);
+            }
+            close(sibling.result_fd);
+        }
+
+        worker_main(command_pipe[0], result_pipe[1]);
+        _exit(0);
+    }
+
+    close(command_pipe[0]);
+    close(result_pipe[1]);
+
+    worker.command_fd = command_pipe[1];
+    worker.result_fd = result_pipe[0];
+    worker.busy = false;
+    worker.trial_id = 0;
+
+    return true;
+}
+
+/*
+ * @brief  Hands the next pending trial to an idle worker, or closes its
+ *          command pipe if no trials remain
+ */
+void falcon_simulation_environment_batch_runner::dispatch_next_trial(worker_process &worker)
+{
+    if (worker.command_fd < 0)
+    {
+        return;
+    }
+
+    if (!m_pending_trials.empty())
+    {
+        FalconTrialId trial_id = m_pending_trials.front();
+        if (write_fully(worker.command_fd, &trial_id, sizeof(trial_id)))
+        {
+            m_pending_trials.pop_front();
+            worker.busy = true;
+            worker.trial_id = trial_id;
+            return;
+        }
+    }
+
+    close(worker.command_fd);
+    worker.command_fd = -1;
+}
+
+void falcon_simulation_environment_batch_runner::collect_worker_output(worker_process &worker)
+{
+    char buffer[RESULT_READ_SIZE];
+
+    ssize_t num_read = read(worker.result_fd, buffer, sizeof(buffer));
+    if (num_read < 0 && errno == EINTR)
+    {
+        return;
+    }
+
+    if (num_read > 0)
+    {
+        worker.pending_output.append(buffer, num_read);
+
+        size_t newline;
+        while ((newline = worker.pending_output.find('\n')) != std::string::npos)
+        {
+            record_result(worker.pending_output.substr(0, newline));
+            worker.pending_output.erase(0, newline + 1);
+
+            worker.busy = false;
+            dispatch_next_trial(worker);
+        }
+
+        return;
+    }
+
+    /* the worker exited */
+    if (worker.command_fd >= 0)
+    {
+        close(worker.command_fd);
+        worker.command_fd = -1;
+    }
+
+    close(worker.result_fd);
+    worker.result_fd = -1;
+
+    replace_exited_worker(worker);
+}
+
+/*
+ * @brief  Reaps an exited worker, requeues or fails the trial it was running
+ *          and starts a replacement if trials remain
+ *
+ * A trial that has exhausted its attempts is recorded as failed so that a
+ *  resumed sweep runs it again.
+ */
+void falcon_simulation_environment_batch_runner::replace_exited_worker(worker_process &worker)
+{
+    int status = 0;
+    waitpid(worker.pid, &status, 0);
+    worker.pid = -1;
+    worker.pending_output.clear();
+
+    if (worker.busy)
+    {
+        uint32_t attempts = ++m_trial_attempts[worker.trial_id];
+        if (attempts < FALCON_BATCH_MAX_TRIAL_ATTEMPTS)
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Sweep worker exited during trial " << worker.trial_id << " (attempt "
+                                       << attempts << " of " << FALCON_BATCH_MAX_TRIAL_ATTEMPTS << "); retrying";
+            m_pending_trials.push_back(worker.trial_id);
+        }
+        else
+        {
+            BOOST_LOG_TRIVIAL(error) << "Sweep worker exited during trial " << worker.trial_id << " on all "
+                                     << FALCON_BATCH_MAX_TRIAL_ATTEMPTS << " attempts";
+            record_result(format_result((*m_trials)[worker.trial_id], FALCON_BATCH_WORKER_EXITED_STR, 0, 0, 0.0));
+        }
+        worker.busy = false;
+    }
+
+    if (m_pending_trials.empty())
+    {
+        return;
+    }
+
+    /* idle workers have been told that no trials remain and may be gone, so
+     *  the requeued trial could otherwise be stranded */
+    if (!spawn_worker(worker))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to replace sweep worker process";
+        return;
+    }
+
+    dispatch_next_trial(worker);
+}
+
+/*
+ * @brief  Appends a line to the results file and forces it to disk, so that
+ *          a completed trial survives a crash of the sweep
+ */
+void falcon_simulation_environment_batch_runner::record_result(const std::string &line)
+{
+    fputs(line.c_str(), m_results_file);
+    fputc('\n', m_results_file);
+    fflush(m_results_file);
+    fdatasync(fileno(m_results_file));
+
+    if (!line.empty() && line[0] != '#')
+    {
+        std::vector<std::string> fields = split_fields(line);
+        if (fields.size() <= RESULT_STATUS_FIELD || fields[RESULT_STATUS_FIELD] != "SUCCESS")
+        {
+            m_num_failed++;
+        }
+        m_num_recorded++;
+    }
+}
+
+/*
+ * @brief  Worker process loop; runs trials until the command pipe is closed
+ */
+void falcon_simulation_environment_batch_runner::worker_main(int command_fd, int result_fd)
+{
+    FalconTrialId trial_id;
+
+    while (read_fully(command_fd, &trial_id, sizeof(trial_id)))
+    {
+        std::string line = run_trial((*m_trials)[trial_id]) + "\n";
+        if (!write_fully(result_fd, line.data(), line.size()))
+        {
+            break;
+        }
+    }
+
+    for (auto &entry : m_scenario_instances)
+    {
+        if (entry.second.manager != nullptr)
+        {
+            entry.second.manager->shutdown();
+        }
+    }
+    m_scenario_instances.clear();
+
+    close(command_fd);
+    close(result_fd);
+}
+
+std::string falcon_simulation_environment_batch_runner::run_trial(const falcon_simulation_environment_sweep_trial &trial)
+{
+    scenario_instance &instance = m_scenario_instances[trial.scenario_name];
+    uint64_t num_timesteps = 0;
+    int64_t initial_reward = 0;
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    FALCON_MANAGER_STATUS_ENUM ret = prepare_scenario(trial.scenario_name, instance);
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        ret = instance.manager->configure_trial(trial.seed, trial.parameters);
+    }
+
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        initial_reward = instance.manager->get_cumulative_reward();
+
+        uint64_t trial_timesteps = trial.duration_in_secs * FALCON_MANAGER_TIMESTEPS_PER_SEC;
+        while (num_timesteps < trial_timesteps && ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            ret = instance.manager->step();
+            num_timesteps += (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS) ? 1 : 0;
+        }
+    }
+
+    double elapsed_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    int64_t cumulative_reward = instance.manager->get_cumulative_reward() - initial_reward;
+
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        /* never reuse a manager left in an unknown state */
+        instance.reusable = false;
+    }
+
+    return format_result(trial, instance.manager->get_manager_status_str(ret), num_timesteps, cumulative_reward, elapsed_secs);
+}
+
+/*
+ * @brief  Readies a scenario manager for the next trial
+ *
+ * A manager whose components support state serialization is initialized once
+ *  and restored to its post-initialization snapshot for every later trial;
+ *  otherwise a fresh manager is built and initialized for each trial. The
+ *  instance always holds a manager on return, even on failure.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_batch_runner::prepare_scenario(const std::string &scenario_name,
+                                                                                        scenario_instance &instance)
+{
+    if (instance.manager != nullptr && instance.reusable)
+    {
+        FALCON_MANAGER_STATUS_ENUM ret = instance.manager->restore_snapshot();
+        if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    if (instance.manager != nullptr)
+    {
+        instance.manager->shutdown();
+        instance.manager.reset();
+    }
+
+    instance.manager.reset(new falcon_simulation_environment_manager());
+    instance.reusable = false;
+
+    FALCON_MANAGER_STATUS_ENUM ret =
+        falcon_simulation_environment_scenario_registry::get_instance().add_scenario_components(scenario_name, *instance.manager);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    std::vector<char *> args;
+    for (auto arg : WORKER_MANAGER_ARGS)
+    {
+        args.push_back(const_cast<char *>(arg));
+    }
+
+    ret = instance.manager->initialize(static_cast<int>(args.size()), args.data());
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    instance.reusable = (instance.manager->snapshot() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    if (!instance.reusable)
+    {
+        BOOST_LOG_TRIVIAL(debug) << "Scenario " << scenario_name << " does not support snapshots; "
+                                 << "re-initializing it for every trial";
+    }
+
+    return ret;
+}
@@ -0,0 +1,166 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_benchmark_scenarios.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment benchmark scenarios.
+ *
+ * @section  DESCRIPTION
+ *
+ * Registers scenarios whose components only burn a fixed amount of CPU time
+ *  per timestep, so that schedules can be compared without a model attached.
+ *
+ * "skewed_load" has a first wave of four light sources and a second wave of
+ *  twelve dependents, the last of which costs as much as the other eleven
+ *  together. Compare, for example,
+ *
+ *      falcon_simulation --scenario skewed_load --threads 4 --schedule dynamic
+ *      falcon_simulation --scenario skewed_load --threads 4 --schedule adaptive
+ *
+ *  where the dynamic schedule tends to start the heavy component last.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <memory>
+
+#include "common/falcon_simulation_environment_component.h"
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t SKEWED_LOAD_NUM_SOURCES = 4;
+static const uint32_t SKEWED_LOAD_NUM_DEPENDENTS = 12;
+static const FalconComponentId SKEWED_LOAD_FIRST_DEPENDENT_ID = 100;
+
+static const uint32_t SKEWED_LOAD_SOURCE_COST_US = 50;
+static const uint32_t SKEWED_LOAD_DEPENDENT_COST_US = 100;
+static const uint32_t SKEWED_LOAD_HEAVY_COST_US = 1200;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_benchmark_busy_component : public falcon_simulation_environment_component
+{
+public:
+
+    falcon_benchmark_busy_component(FalconComponentId id, uint32_t cost_us, FalconComponentIdList dependencies) :
+        m_cost_us(cost_us)
+    {
+        set_component_id(id);
+        set_timestep_advance_dependencies(dependencies);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        /* spin rather than sleep so the cost is CPU time on the worker */
+        auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(m_cost_us);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            /* busy wait */
+        }
+
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return 1;
+    }
+
+private:
+
+    uint32_t m_cost_us;
+};
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static FALCON_MANAGER_STATUS_ENUM add_skewed_load_components(falcon_simulation_environment_manager &manager)
+{
+    for (uint32_t ii = 0; ii < SKEWED_LOAD_NUM_SOURCES; ++ii)
+    {
+        FALCON_MANAGER_STATUS_ENUM ret = manager.add_component(std::make_shared<falcon_benchmark_busy_component>(
+            ii, SKEWED_LOAD_SOURCE_COST_US, FalconComponentIdList()));
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    for (uint32_t ii = 0; ii < SKEWED_LOAD_NUM_DEPENDENTS; ++ii)
+    {
+        uint32_t cost_us = (ii + 1 == SKEWED_LOAD_NUM_DEPENDENTS) ? SKEWED_LOAD_HEAVY_COST_US : SKEWED_LOAD_DEPENDENT_COST_US;
+        FalconComponentIdList dependencies = { ii % SKEWED_LOAD_NUM_SOURCES };
+        FALCON_MANAGER_STATUS_ENUM ret = manager.add_component(std::make_shared<falcon_benchmark_busy_component>(
+            SKEWED_LOAD_FIRST_DEPENDENT_ID + ii, cost_us, dependencies));
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_REGISTER_SCENARIO(skewed_load, add_skewed_load_components);
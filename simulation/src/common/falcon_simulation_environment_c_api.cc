@@ -0,0 +1,331 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_c_api.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment C interface.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the C ABI as thin wrappers around the simulation environment
+ *  manager. Nothing on the step path allocates, copies or serializes.
+ *
+ * Every entry point checks its handle and pointer arguments and catches any
+ *  exception raised below it, since unwinding into a C or Python caller is
+ *  undefined behavior.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added argument checks and exception guards.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <boost/log/trivial.hpp>
+#include <exception>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_c_api.h"
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const char *INVALID_ARGUMENT_STR = "INVALID_ARGUMENT";
+static const char *INTERNAL_ERROR_STR = "INTERNAL_ERROR";
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct falcon_simulation
+{
+    std::string                              scenario_name;
+    bool                                     initialize_called;
+    bool                                     initialized;
+    falcon_simulation_environment_manager    manager;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+/*
+ * @brief  Runs a manager call on behalf of a C entry point, converting a
+ *          null handle or an escaping exception into an error code
+ */
+template <typename FUNCTION>
+static int call_manager(falcon_simulation *sim, const char *name, FUNCTION function)
+{
+    if (sim == nullptr)
+    {
+        return FALCON_SIMULATION_INVALID_ARGUMENT;
+    }
+
+    try
+    {
+        return static_cast<int>(function(sim->manager));
+    }
+    catch (const std::exception &e)
+    {
+        BOOST_LOG_TRIVIAL(error) << name << " failed: " << e.what();
+    }
+    catch (...)
+    {
+        BOOST_LOG_TRIVIAL(error) << name << " failed with an unknown exception";
+    }
+
+    return FALCON_SIMULATION_INTERNAL_ERROR;
+}
+
+/*
+ * @brief  Returns a manager-owned buffer, or nullptr and a zero count
+ */
+template <typename T, typename FUNCTION>
+static T * get_manager_buffer(falcon_simulation *sim, size_t *num_values, FUNCTION function)
+{
+    if (num_values == nullptr)
+    {
+        return nullptr;
+    }
+
+    *num_values = 0;
+    if (sim == nullptr)
+    {
+        return nullptr;
+    }
+
+    /* the buffers are allocated at initialize() so this cannot throw */
+    return function(sim->manager, *num_values);
+}
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation * falcon_simulation_create(const char *scenario_name)
+{
+    if (scenario_name == nullptr)
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        if (!falcon_simulation_environment_scenario_registry::get_instance().has_scenario(scenario_name))
+        {
+            return nullptr;
+        }
+
+        falcon_simulation *sim = new falcon_simulation;
+        sim->scenario_name = scenario_name;
+        sim->initialize_called = false;
+        sim->initialized = false;
+
+        return sim;
+    }
+    catch (const std::exception &e)
+    {
+        BOOST_LOG_TRIVIAL(error) << "falcon_simulation_create failed: " << e.what();
+    }
+    catch (...)
+    {
+        BOOST_LOG_TRIVIAL(error) << "falcon_simulation_create failed with an unknown exception";
+    }
+
+    return nullptr;
+}
+
+void falcon_simulation_destroy(falcon_simulation *sim)
+{
+    if (sim == nullptr)
+    {
+        return;
+    }
+
+    falcon_simulation_shutdown(sim);
+
+    try
+    {
+        delete sim;
+    }
+    catch (...)
+    {
+        BOOST_LOG_TRIVIAL(error) << "falcon_simulation_destroy failed";
+    }
+}
+
+int falcon_simulation_initialize(falcon_simulation *sim, int argc, const char **argv)
+{
+    if (argc < 0 || (argc > 0 && argv == nullptr))
+    {
+        return FALCON_SIMULATION_INVALID_ARGUMENT;
+    }
+
+    return call_manager(sim, "falcon_simulation_initialize", [&](falcon_simulation_environment_manager &manager) {
+        /* a failed attempt may have added components, so it is not repeatable */
+        if (sim->initialize_called)
+        {
+            return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+        }
+        sim->initialize_called = true;
+
+        for (int ii = 0; ii < argc; ++ii)
+        {
+            if (argv[ii] == nullptr)
+            {
+                return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+            }
+        }
+
+        FALCON_MANAGER_STATUS_ENUM ret = falcon_simulation_environment_scenario_registry::get_instance().add_scenario_components(
+            sim->scenario_name, manager);
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+
+        /* the manager expects a conventional argv including the program name */
+        std::vector<char *> args;
+        args.push_back(const_cast<char *>("falcon_simulation"));
+        for (int ii = 0; ii < argc; ++ii)
+        {
+            args.push_back(const_cast<char *>(argv[ii]));
+        }
+        args.push_back(nullptr);
+
+        ret = manager.initialize(static_cast<int>(args.size()) - 1, args.data());
+        sim->initialized = (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+        return ret;
+    });
+}
+
+int falcon_simulation_step(falcon_simulation *sim)
+{
+    return call_manager(sim, "falcon_simulation_step", [](falcon_simulation_environment_manager &manager) {
+        return manager.step();
+    });
+}
+
+int falcon_simulation_snapshot(falcon_simulation *sim)
+{
+    return call_manager(sim, "falcon_simulation_snapshot", [](falcon_simulation_environment_manager &manager) {
+        return manager.snapshot();
+    });
+}
+
+int falcon_simulation_reset(falcon_simulation *sim)
+{
+    return call_manager(sim, "falcon_simulation_reset", [](falcon_simulation_environment_manager &manager) {
+        return manager.restore_snapshot();
+    });
+}
+
+int falcon_simulation_shutdown(falcon_simulation *sim)
+{
+    return call_manager(sim, "falcon_simulation_shutdown", [&](falcon_simulation_environment_manager &manager) {
+        /* the manager only shuts down what initialize() started */
+        if (!sim->initialized)
+        {
+            return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+        }
+        sim->initialized = false;
+
+        return manager.shutdown();
+    });
+}
+
+float * falcon_simulation_get_observations(falcon_simulation *sim, size_t *num_values)
+{
+    return get_manager_buffer<float>(sim, num_values, [](falcon_simulation_environment_manager &manager, size_t &count) {
+        return manager.get_observation_buffer(count);
+    });
+}
+
+float * falcon_simulation_get_actions(falcon_simulation *sim, size_t *num_values)
+{
+    return get_manager_buffer<float>(sim, num_values, [](falcon_simulation_environment_manager &manager, size_t &count) {
+        return manager.get_action_buffer(count);
+    });
+}
+
+int32_t * falcon_simulation_get_rewards(falcon_simulation *sim, size_t *num_values)
+{
+    return get_manager_buffer<int32_t>(sim, num_values, [](falcon_simulation_environment_manager &manager, size_t &count) {
+        return manager.get_reward_buffer(count);
+    });
+}
+
+int32_t falcon_simulation_get_timestep_reward(falcon_simulation *sim)
+{
+    return (sim != nullptr) ? sim->manager.get_timestep_reward() : 0;
+}
+
+int64_t falcon_simulation_get_cumulative_reward(falcon_simulation *sim)
+{
+    return (sim != nullptr) ? sim->manager.get_cumulative_reward() : 0;
+}
+
+uint32_t falcon_simulation_get_current_timestep(falcon_simulation *sim)
+{
+    return (sim != nullptr) ? sim->manager.get_current_timestep() : 0;
+}
+
+const char * falcon_simulation_get_status_str(falcon_simulation *sim, int status)
+{
+    switch (status)
+    {
+    case FALCON_SIMULATION_INVALID_ARGUMENT:
+        return INVALID_ARGUMENT_STR;
+    case FALCON_SIMULATION_INTERNAL_ERROR:
+        return INTERNAL_ERROR_STR;
+    default:
+        break;
+    }
+
+    if (sim == nullptr || status < 0)
+    {
+        return nullptr;
+    }
+
+    return sim->manager.get_manager_status_str(static_cast<FALCON_MANAGER_STATUS_ENUM>(status));
+}
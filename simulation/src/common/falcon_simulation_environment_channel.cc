@@ -0,0 +1,119 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_channel.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment inter-component message channels.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the non-template portions of the inter-component message
+ *  channels, namely the type-erased channel base class and the registry that
+ *  owns every channel in a simulation.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include "common/falcon_simulation_environment_channel.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_channel_base::falcon_simulation_environment_channel_base(FalconChannelId id)
+  : m_channel_id(id)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_channel_base::~falcon_simulation_environment_channel_base(void)
+{
+    /* no action required at this time */
+}
+
+FalconChannelId falcon_simulation_environment_channel_base::get_channel_id(void) const
+{
+    return m_channel_id;
+}
+
+falcon_simulation_environment_channel_registry::falcon_simulation_environment_channel_registry(void)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_channel_registry::~falcon_simulation_environment_channel_registry(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Looks up an existing channel without regard to its message type
+ *
+ * @return Channel if it exists; nullptr otherwise.
+ */
+std::shared_ptr<falcon_simulation_environment_channel_base> falcon_simulation_environment_channel_registry::find_channel(FalconChannelId id)
+{
+    auto iter = m_channels.find(id);
+    if (iter != m_channels.end())
+    {
+        return iter->second;
+    }
+
+    return nullptr;
+}
+
+FalconChannelIdList falcon_simulation_environment_channel_registry::get_channel_ids(void)
+{
+    FalconChannelIdList ret;
+    for (auto &entry : m_channels)
+    {
+        ret.push_back(entry.first);
+    }
+
+    return ret;
+}
@@ -0,0 +1,472 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_checkpoint_writer.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment asynchronous checkpoint writer.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the asynchronous checkpoint writer. The manifest is text:
+ *
+ *      falcon_checkpoint <version>
+ *      timestep <timestep>
+ *      cumulative_reward <reward>
+ *      record <name> <file> <size> <hash>
+ *      ...
+ *
+ *  Files written for a checkpoint are synced before the manifest is renamed
+ *  into place; files that the new manifest no longer names are removed only
+ *  after the rename.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_checkpoint_writer.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+static const char *MANIFEST_NAME = "checkpoint.manifest";
+static const char *MANIFEST_MAGIC = "falcon_checkpoint";
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static uint64_t hash_buffer(const FalconStateBuffer &buffer)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    for (uint8_t byte : buffer)
+    {
+        hash ^= byte;
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static bool sync_directory(const std::string &directory)
+{
+    int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    bool ret = (fsync(fd) == 0);
+    close(fd);
+
+    return ret;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_checkpoint_writer::falcon_simulation_environment_checkpoint_writer(void)
+  : m_busy(false),
+    m_shutdown_requested(false)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_checkpoint_writer::~falcon_simulation_environment_checkpoint_writer(void)
+{
+    shutdown();
+}
+
+/*
+ * @brief  Creates the checkpoint directory, if needed, and starts the writer
+ *          thread
+ */
+bool falcon_simulation_environment_checkpoint_writer::initialize(const std::string &directory,
+                                                                 const std::string &prefix)
+{
+    if (m_thread.joinable())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Checkpoint writer is already running";
+        return false;
+    }
+
+    if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to create checkpoint directory " << directory;
+        return false;
+    }
+
+    m_directory = directory;
+    m_prefix = prefix;
+    m_busy = false;
+    m_shutdown_requested = false;
+    m_thread = std::thread(&falcon_simulation_environment_checkpoint_writer::writer_thread_main, this);
+
+    return true;
+}
+
+/*
+ * @brief  Finishes any checkpoint being written and stops the writer thread
+ */
+void falcon_simulation_environment_checkpoint_writer::shutdown(void)
+{
+    if (!m_thread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown_requested = true;
+    }
+    m_cv.notify_all();
+
+    m_thread.join();
+}
+
+bool falcon_simulation_environment_checkpoint_writer::is_busy(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_busy;
+}
+
+/*
+ * @brief  Hands a checkpoint to the writer thread
+ *
+ * The checkpoint is swapped with the buffers of the previously written one,
+ *  so the caller can capture the next checkpoint without reallocating.
+ */
+bool falcon_simulation_environment_checkpoint_writer::submit(falcon_simulation_environment_checkpoint &checkpoint)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_thread.joinable() || m_busy)
+        {
+            return false;
+        }
+
+        std::swap(m_pending, checkpoint);
+        m_busy = true;
+    }
+    m_cv.notify_all();
+
+    return true;
+}
+
+/*
+ * @brief  Loads the last committed checkpoint, verifying every record
+ *
+ * @return True if a complete checkpoint was loaded; false if there is none
+ *          or it is damaged.
+ */
+bool falcon_simulation_environment_checkpoint_writer::load(const std::string &directory,
+                                                           const std::string &prefix,
+                                                           falcon_simulation_environment_checkpoint &checkpoint)
+{
+    if (m_thread.joinable())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Checkpoints must be loaded before the writer is started";
+        return false;
+    }
+
+    m_directory = directory;
+    m_prefix = prefix;
+
+    std::string manifest_path = get_path(get_manifest_name());
+    std::ifstream manifest(manifest_path);
+    if (!manifest.is_open())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to open checkpoint manifest " << manifest_path;
+        return false;
+    }
+
+    std::string magic;
+    uint32_t version = 0;
+    manifest >> magic >> version;
+    if (magic != MANIFEST_MAGIC || version != FALCON_CHECKPOINT_FORMAT_VERSION)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unsupported checkpoint manifest " << manifest_path;
+        return false;
+    }
+
+    checkpoint.records.clear();
+    std::map<std::string, record_file> committed_files;
+
+    std::string line;
+    bool have_timestep = false;
+    bool have_reward = false;
+    while (std::getline(manifest, line))
+    {
+        std::stringstream ss(line);
+        std::string key;
+        if (!(ss >> key))
+        {
+            continue;
+        }
+
+        if (key == "timestep" && (ss >> checkpoint.timestep))
+        {
+            have_timestep = true;
+        }
+        else if (key == "cumulative_reward" && (ss >> checkpoint.cumulative_reward))
+        {
+            have_reward = true;
+        }
+        else if (key == "record")
+        {
+            std::string name;
+            record_file file;
+            if (!(ss >> name >> file.file_name >> file.size >> file.hash))
+            {
+                BOOST_LOG_TRIVIAL(error) << "Malformed checkpoint record: " << line;
+                return false;
+            }
+
+            std::ifstream input(get_path(file.file_name), std::ios::binary);
+            FalconStateBuffer &buffer = checkpoint.records[name];
+            buffer.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+            if (!input.is_open() || buffer.size() != file.size || hash_buffer(buffer) != file.hash)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Checkpoint file " << file.file_name << " is missing or damaged";
+                return false;
+            }
+
+            committed_files[name] = file;
+        }
+        else
+        {
+            BOOST_LOG_TRIVIAL(error) << "Malformed checkpoint manifest line: " << line;
+            return false;
+        }
+    }
+
+    if (!have_timestep || !have_reward)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Checkpoint manifest " << manifest_path << " is incomplete";
+        return false;
+    }
+
+    m_committed_files = committed_files;
+
+    return true;
+}
+
+void falcon_simulation_environment_checkpoint_writer::writer_thread_main(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_cv.wait(lock, [this]{ return m_busy || m_shutdown_requested; });
+        if (!m_busy)
+        {
+            break;
+        }
+
+        /* the caller cannot touch the pending checkpoint while busy is set,
+         *  so it is written without holding the lock */
+        lock.unlock();
+        auto start = std::chrono::steady_clock::now();
+        bool success = write_checkpoint(m_pending);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        if (success)
+        {
+            BOOST_LOG_TRIVIAL(debug) << "Wrote checkpoint for timestep " << m_pending.timestep
+                                     << " in " << elapsed.count() << " ms";
+        }
+        else
+        {
+            BOOST_LOG_TRIVIAL(error) << "Failed to write checkpoint for timestep " << m_pending.timestep;
+        }
+        lock.lock();
+
+        m_busy = false;
+    }
+}
+
+/*
+ * @brief  Writes the changed records of a checkpoint and commits its manifest
+ */
+bool falcon_simulation_environment_checkpoint_writer::write_checkpoint(const falcon_simulation_environment_checkpoint &checkpoint)
+{
+    std::map<std::string, record_file> committed_files;
+    std::vector<std::string> stale_files;
+
+    for (auto &record : checkpoint.records)
+    {
+        record_file file;
+        file.hash = hash_buffer(record.second);
+        file.size = record.second.size();
+
+        auto iter = m_committed_files.find(record.first);
+        if (iter != m_committed_files.end() && iter->second.hash == file.hash && iter->second.size == file.size)
+        {
+            committed_files[record.first] = iter->second;
+            continue;
+        }
+
+        std::stringstream ss;
+        ss << m_prefix << record.first << "." << checkpoint.timestep << ".bin";
+        file.file_name = ss.str();
+
+        if (!write_file(file.file_name, record.second.data(), record.second.size()))
+        {
+            return false;
+        }
+
+        committed_files[record.first] = file;
+        if (iter != m_committed_files.end() && iter->second.file_name != file.file_name)
+        {
+            stale_files.push_back(iter->second.file_name);
+        }
+    }
+
+    for (auto &file : m_committed_files)
+    {
+        if (checkpoint.records.count(file.first) == 0)
+        {
+            stale_files.push_back(file.second.file_name);
+        }
+    }
+
+    std::stringstream manifest;
+    manifest << MANIFEST_MAGIC << " " << FALCON_CHECKPOINT_FORMAT_VERSION << "\n"
+             << "timestep " << checkpoint.timestep << "\n"
+             << "cumulative_reward " << checkpoint.cumulative_reward << "\n";
+    for (auto &file : committed_files)
+    {
+        manifest << "record " << file.first << " " << file.second.file_name << " "
+                 << file.second.size << " " << file.second.hash << "\n";
+    }
+
+    /* the new files must be durable before the manifest refers to them */
+    std::string manifest_name = get_manifest_name();
+    std::string contents = manifest.str();
+    if (!sync_directory(m_directory) ||
+        !write_file(manifest_name + ".tmp", reinterpret_cast<const uint8_t *>(contents.data()), contents.size()) ||
+        rename(get_path(manifest_name + ".tmp").c_str(), get_path(manifest_name).c_str()) != 0 ||
+        !sync_directory(m_directory))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to commit checkpoint manifest " << get_path(manifest_name);
+        return false;
+    }
+
+    m_committed_files = committed_files;
+
+    for (auto &file_name : stale_files)
+    {
+        unlink(get_path(file_name).c_str());
+    }
+
+    return true;
+}
+
+bool falcon_simulation_environment_checkpoint_writer::write_file(const std::string &file_name,
+                                                                 const uint8_t *data, size_t size)
+{
+    std::string path = get_path(file_name);
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to open checkpoint file " << path;
+        return false;
+    }
+
+    while (size > 0)
+    {
+        ssize_t ret = write(fd, data, size);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Unable to write checkpoint file " << path;
+            close(fd);
+            return false;
+        }
+
+        data += ret;
+        size -= ret;
+    }
+
+    bool ret = (fdatasync(fd) == 0);
+    close(fd);
+
+    if (!ret)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to sync checkpoint file " << path;
+    }
+
+    return ret;
+}
+
+std::string falcon_simulation_environment_checkpoint_writer::get_path(const std::string &file_name) const
+{
+    return m_directory + "/" + file_name;
+}
+
+std::string falcon_simulation_environment_checkpoint_writer::get_manifest_name(void) const
+{
+    return m_prefix + MANIFEST_NAME;
+}
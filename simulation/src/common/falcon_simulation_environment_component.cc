@@ -40,6 +40,17 @@
  * @section  HISTORY
  *
  * 24-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added component identifiers and inter-component
+ *                               message channels.
+ * 19-Oct-2026  OrthogonalHawk  Added previous timestep dependencies.
+ * 19-Oct-2026  OrthogonalHawk  Added component state serialization.
+ * 19-Oct-2026  OrthogonalHawk  Added observation and action buffers.
+ * 19-Oct-2026  OrthogonalHawk  Added per-trial configuration hook.
+ * 19-Oct-2026  OrthogonalHawk  Added component state metrics.
+ * 19-Oct-2026  OrthogonalHawk  Skip publishing for components without state.
+ * 19-Oct-2026  OrthogonalHawk  Ignore metrics attached without state gauges.
+ * 19-Oct-2026  OrthogonalHawk  Components are marked once they have advanced.
+ * 19-Oct-2026  OrthogonalHawk  Components opt in to publication explicitly.
  *
  *****************************************************************************/
 
@@ -87,11 +98,16 @@ const char * falcon_simulation_environment_component::component_status_names[sta
     "UNSUPPORTED_TIMESTEP_ADVANCE_DEPENDENCY",
     "UNSUPPORTED_COMPONENT_STATE",
     "UNSUPPORTED_COMPONENT_STATE_TRANSITION",
+    "UNSUPPORTED_STATE_SERIALIZATION",
     "FAILURE"
 };
 
 falcon_simulation_environment_component::falcon_simulation_environment_component(void)
-  : m_component_state(FALCON_COMPONENT_STATE_ENUM::UNINITIALIZED)
+  : m_component_id(0),
+    m_component_state(FALCON_COMPONENT_STATE_ENUM::UNINITIALIZED),
+    m_observations(nullptr),
+    m_actions(nullptr),
+    m_state_metric_base(FALCON_METRICS_INVALID_ID)
 {
     /* no action required at this time */
 }
@@ -101,6 +117,11 @@ falcon_simulation_environment_component::~falcon_simulation_environment_componen
     /* no action required at this time */
 }
 
+FalconComponentId falcon_simulation_environment_component::get_component_id(void)
+{
+    return m_component_id;
+}
+
 FalconComponentIdList falcon_simulation_environment_component::get_initialization_dependency_ids(void)
 {
     return m_initialization_dependency_ids;
@@ -111,11 +132,77 @@ FalconComponentIdList falcon_simulation_environment_component::get_timestep_adva
     return m_timestep_advance_dependency_ids;
 }
 
+/*
+ * @brief  Dependencies whose state is read as of the end of the previous timestep
+ *
+ * Unlike timestep advance dependencies these do not have to advance first,
+ *  so they do not constrain the order in which components are advanced. The
+ *  dependency must double-buffer any state read this way.
+ */
+FalconComponentIdList falcon_simulation_environment_component::get_previous_timestep_dependency_ids(void)
+{
+    return m_previous_timestep_dependency_ids;
+}
+
 FalconComponentIdList falcon_simulation_environment_component::get_shutdown_dependency_ids(void)
 {
     return m_shutdown_dependency_ids;
 }
 
+FalconChannelIdList falcon_simulation_environment_component::get_input_channel_ids(void)
+{
+    return m_input_channel_ids;
+}
+
+FalconChannelIdList falcon_simulation_environment_component::get_output_channel_ids(void)
+{
+    return m_output_channel_ids;
+}
+
+/*
+ * @brief  Invoked by external manager before initialize() so that the component
+ *          is able to open its message channels
+ */
+void falcon_simulation_environment_component::attach_channel_registry(std::shared_ptr<falcon_simulation_environment_channel_registry> registry)
+{
+    m_channel_registry = registry;
+}
+
+/*
+ * @brief  Counts this component in the gauge of its current state and keeps
+ *          the per-state gauges up to date on every transition
+ */
+void falcon_simulation_environment_component::attach_metrics(std::shared_ptr<falcon_simulation_environment_metrics> metrics, FalconMetricId state_metric_base)
+{
+    if (m_metrics != nullptr)
+    {
+        m_metrics->add(m_state_metric_base + static_cast<uint32_t>(m_component_state), -1);
+    }
+
+    /* the state gauges are addressed relative to the base, so an invalid
+     *  base must not be offset into a valid id */
+    m_metrics = (state_metric_base != FALCON_METRICS_INVALID_ID) ? metrics : nullptr;
+    m_state_metric_base = state_metric_base;
+
+    if (m_metrics != nullptr)
+    {
+        m_metrics->add(m_state_metric_base + static_cast<uint32_t>(m_component_state), 1);
+    }
+}
+
+/*
+ * @brief  Invoked by external manager before each trial of a parameter sweep,
+ *          after the component has been initialized or restored from a
+ *          snapshot; components seed their random number generators and apply
+ *          sweep parameters here
+ */
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::configure_trial(uint64_t seed, const FalconTrialParameters &parameters)
+{
+    (void)seed;
+    (void)parameters;
+    return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+}
+
 /*
  * @brief  Invoked by external manager to indicate that the next timestep is starting
  */
@@ -124,6 +211,82 @@ FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::next_times
     return transition(FALCON_COMPONENT_STATE_ENUM::WAITING_FOR_TIMESTEP_ADVANCE);
 }
 
+/*
+ * @brief  Invoked by external manager once advance_timestep() has succeeded
+ */
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::timestep_advance_completed(void)
+{
+    return transition(FALCON_COMPONENT_STATE_ENUM::TIMESTEP_ADVANCED);
+}
+
+/*
+ * @brief  Indicates whether the component holds double-buffered state and
+ *          must be published every timestep; read once at initialization
+ */
+bool falcon_simulation_environment_component::uses_double_buffered_state(void) const
+{
+    return false;
+}
+
+/*
+ * @brief  Invoked by external manager once every component has advanced the
+ *          current timestep; components holding double-buffered state swap
+ *          their buffers here
+ */
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::publish_timestep_state(void)
+{
+    return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Number of observation values the component writes each timestep
+ */
+uint32_t falcon_simulation_environment_component::get_observation_size(void)
+{
+    return 0;
+}
+
+/*
+ * @brief  Number of action values the component reads each timestep
+ */
+uint32_t falcon_simulation_environment_component::get_action_size(void)
+{
+    return 0;
+}
+
+/*
+ * @brief  Invoked by external manager after initialize() to hand the component
+ *          its slices of the manager's preallocated observation and action
+ *          buffers; the slices remain valid until the manager is destroyed
+ */
+void falcon_simulation_environment_component::attach_step_buffers(FalconObservationValue *observations, const FalconActionValue *actions)
+{
+    m_observations = observations;
+    m_actions = actions;
+}
+
+/*
+ * @brief  Captures the component state visible to its dependents
+ *
+ * Required for components whose state crosses a process boundary in a
+ *  distributed simulation; the default implementation reports that the
+ *  component does not support serialization.
+ */
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::serialize_state(FalconStateBuffer &buffer)
+{
+    buffer.clear();
+    return FALCON_COMPONENT_STATUS_ENUM::UNSUPPORTED_STATE_SERIALIZATION;
+}
+
+/*
+ * @brief  Restores state previously captured by serialize_state()
+ */
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::deserialize_state(const FalconStateBuffer &buffer)
+{
+    (void)buffer;
+    return FALCON_COMPONENT_STATUS_ENUM::UNSUPPORTED_STATE_SERIALIZATION;
+}
+
 FALCON_COMPONENT_STATE_ENUM falcon_simulation_environment_component::get_component_state(void)
 {
     return m_component_state;
@@ -135,7 +298,7 @@ const char * falcon_simulation_environment_component::get_component_state_str(FA
     if (state >= FALCON_COMPONENT_STATE_ENUM::UNINITIALIZED &&
         state <  FALCON_COMPONENT_STATE_ENUM::NUMBER_OF_STATES)
     {
-        return component_status_names[static_cast<uint32_t>(state)];
+        return component_state_names[static_cast<uint32_t>(state)];
     }
 
     return nullptr;
@@ -153,6 +316,12 @@ const char * falcon_simulation_environment_component::get_component_status_str(F
     return nullptr;
 }
 
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::set_component_id(FalconComponentId id)
+{
+    m_component_id = id;
+    return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+}
+
 FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::set_initialization_dependencies(FalconComponentIdList &dependency_id_list)
 {
     m_initialization_dependency_ids = dependency_id_list;
@@ -165,12 +334,34 @@ FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::set_timest
     return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
 }
 
+FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::set_previous_timestep_dependencies(FalconComponentIdList &dependency_id_list)
+{
+    m_previous_timestep_dependency_ids = dependency_id_list;
+    return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+}
+
 FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::set_shutdown_dependencies(FalconComponentIdList &dependency_id_list)
 {
     m_shutdown_dependency_ids = dependency_id_list;
     return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
 }
 
+/*
+ * @brief  Slice of get_observation_size() values to fill during advance_timestep()
+ */
+FalconObservationValue * falcon_simulation_environment_component::get_observation_buffer(void)
+{
+    return m_observations;
+}
+
+/*
+ * @brief  Slice of get_action_size() values supplied for the current timestep
+ */
+const FalconActionValue * falcon_simulation_environment_component::get_action_buffer(void)
+{
+    return m_actions;
+}
+
 FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::transition(FALCON_COMPONENT_STATE_ENUM new_state)
 {
     FALCON_COMPONENT_STATUS_ENUM ret = FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
@@ -200,6 +391,12 @@ FALCON_COMPONENT_STATUS_ENUM falcon_simulation_environment_component::transition
 
     if (ret == FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
     {
+        if (m_metrics != nullptr && new_state != m_component_state)
+        {
+            m_metrics->add(m_state_metric_base + static_cast<uint32_t>(m_component_state), -1);
+            m_metrics->add(m_state_metric_base + static_cast<uint32_t>(new_state), 1);
+        }
+
         m_component_state = new_state;
     }
 
@@ -42,6 +42,15 @@
  * @section  HISTORY
  *
  * 25-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added worker thread count option.
+ * 19-Oct-2026  OrthogonalHawk  Added distributed simulation options.
+ * 19-Oct-2026  OrthogonalHawk  Added scenario and parameter sweep options.
+ * 19-Oct-2026  OrthogonalHawk  Added metrics options.
+ * 19-Oct-2026  OrthogonalHawk  Added scheduling and thread pinning options.
+ * 19-Oct-2026  OrthogonalHawk  Added checkpoint options.
+ * 19-Oct-2026  OrthogonalHawk  Dynamic scheduling is the default again.
+ * 19-Oct-2026  OrthogonalHawk  Documented when checkpoints are skipped.
+ * 19-Oct-2026  OrthogonalHawk  Checkpoints are no longer skipped for queued messages.
  *
  *****************************************************************************/
 
@@ -76,7 +85,20 @@
  * @brief  Class constructor
  */
 falcon_simulation_environment_component_arg_parser::falcon_simulation_environment_component_arg_parser(void)
-  : m_duration(0)
+  : m_duration(0),
+    m_num_worker_threads(0),
+    m_rank(0),
+    m_num_ranks(1),
+    m_transport_base_port(FALCON_DEFAULT_TRANSPORT_BASE_PORT),
+    m_scenario_name(FALCON_DEFAULT_SCENARIO_NAME),
+    m_sweep_results_path(FALCON_DEFAULT_SWEEP_RESULTS_PATH),
+    m_num_sweep_workers(0),
+    m_metrics_summary_interval(0),
+    m_adaptive_schedule(false),
+    m_pin_threads(false),
+    m_checkpoint_dir(FALCON_DEFAULT_CHECKPOINT_DIR),
+    m_checkpoint_interval(0),
+    m_resume(false)
 {
     /* no action needed */
 }
@@ -99,6 +121,151 @@ uint64_t falcon_simulation_environment_component_arg_parser::get_simulation_dura
     return m_duration;
 }
 
+/*
+ * @brief Provides access to the requested number of worker threads
+ *
+ * @return Number of worker threads; zero selects one per hardware thread
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_num_worker_threads(void)
+{
+    return m_num_worker_threads;
+}
+
+/*
+ * @brief Provides access to this process' rank in a distributed simulation
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_rank(void)
+{
+    return m_rank;
+}
+
+/*
+ * @brief Provides access to the number of processes in a distributed simulation
+ *
+ * @return Number of ranks; one when the simulation is not distributed
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_num_ranks(void)
+{
+    return m_transport_hosts.empty() ? m_num_ranks : static_cast<uint32_t>(m_transport_hosts.size());
+}
+
+/*
+ * @brief Provides access to the host of every rank, indexed by rank
+ *
+ * @return Hosts from the command-line, or the loopback address for every rank
+ *          if none were provided
+ */
+std::vector<std::string> falcon_simulation_environment_component_arg_parser::get_transport_hosts(void)
+{
+    if (m_transport_hosts.empty())
+    {
+        return std::vector<std::string>(m_num_ranks, "127.0.0.1");
+    }
+
+    return m_transport_hosts;
+}
+
+uint16_t falcon_simulation_environment_component_arg_parser::get_transport_base_port(void)
+{
+    return m_transport_base_port;
+}
+
+/*
+ * @brief Provides access to the name of the registered scenario to simulate
+ */
+std::string falcon_simulation_environment_component_arg_parser::get_scenario_name(void)
+{
+    return m_scenario_name;
+}
+
+/*
+ * @brief Provides access to the parameter sweep specification path
+ *
+ * @return Path to the sweep specification; empty if no sweep was requested
+ */
+std::string falcon_simulation_environment_component_arg_parser::get_sweep_path(void)
+{
+    return m_sweep_path;
+}
+
+std::string falcon_simulation_environment_component_arg_parser::get_sweep_results_path(void)
+{
+    return m_sweep_results_path;
+}
+
+/*
+ * @brief Provides access to the requested number of sweep worker processes
+ *
+ * @return Number of worker processes; zero selects one per hardware thread
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_num_sweep_workers(void)
+{
+    return m_num_sweep_workers;
+}
+
+/*
+ * @brief Provides access to the Unix socket path of the metrics endpoint
+ *
+ * @return Socket path; empty if the endpoint was not requested
+ */
+std::string falcon_simulation_environment_component_arg_parser::get_metrics_socket_path(void)
+{
+    return m_metrics_socket_path;
+}
+
+/*
+ * @brief Provides access to the interval between logged metrics summaries
+ *
+ * @return Interval in seconds; zero if summaries were not requested
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_metrics_summary_interval_in_secs(void)
+{
+    return m_metrics_summary_interval;
+}
+
+/*
+ * @brief Indicates whether components are assigned to worker threads from
+ *         their measured costs, rather than claimed in registration order
+ */
+bool falcon_simulation_environment_component_arg_parser::get_adaptive_schedule(void)
+{
+    return m_adaptive_schedule;
+}
+
+/*
+ * @brief Indicates whether worker threads are pinned to CPUs
+ */
+bool falcon_simulation_environment_component_arg_parser::get_pin_threads(void)
+{
+    return m_pin_threads;
+}
+
+/*
+ * @brief Provides access to the directory holding checkpoints
+ */
+std::string falcon_simulation_environment_component_arg_parser::get_checkpoint_dir(void)
+{
+    return m_checkpoint_dir;
+}
+
+/*
+ * @brief Provides access to the number of timesteps between checkpoints
+ *
+ * @return Interval in timesteps; zero if checkpoints were not requested
+ */
+uint32_t falcon_simulation_environment_component_arg_parser::get_checkpoint_interval_in_timesteps(void)
+{
+    return m_checkpoint_interval;
+}
+
+/*
+ * @brief Indicates whether the simulation resumes from the latest checkpoint
+ */
+bool falcon_simulation_environment_component_arg_parser::get_resume(void)
+{
+    return m_resume;
+}
+
 /*
  * @brief  Handle application-specific arguments
  *
@@ -122,6 +289,122 @@ bool falcon_simulation_environment_component_arg_parser::derived_class_parse(std
             ret = true;
         }
     }
+    else if (option == "-t" || option == "--threads")
+    {
+        int64_t tmp_threads = strtol(value.c_str(), nullptr, 10);
+        if (tmp_threads >= 0)
+        {
+            m_num_worker_threads = tmp_threads;
+            ret = true;
+        }
+    }
+    else if (option == "--rank")
+    {
+        int64_t tmp_rank = strtol(value.c_str(), nullptr, 10);
+        if (tmp_rank >= 0)
+        {
+            m_rank = tmp_rank;
+            ret = true;
+        }
+    }
+    else if (option == "--num-ranks")
+    {
+        int64_t tmp_num_ranks = strtol(value.c_str(), nullptr, 10);
+        if (tmp_num_ranks >= 1)
+        {
+            m_num_ranks = tmp_num_ranks;
+            ret = true;
+        }
+    }
+    else if (option == "--hosts")
+    {
+        std::stringstream hosts(value);
+        std::string host;
+
+        m_transport_hosts.clear();
+        while (std::getline(hosts, host, ','))
+        {
+            m_transport_hosts.push_back(host);
+        }
+
+        ret = !m_transport_hosts.empty();
+    }
+    else if (option == "-s" || option == "--scenario")
+    {
+        m_scenario_name = value;
+        ret = !value.empty();
+    }
+    else if (option == "--sweep")
+    {
+        m_sweep_path = value;
+        ret = !value.empty();
+    }
+    else if (option == "--results")
+    {
+        m_sweep_results_path = value;
+        ret = !value.empty();
+    }
+    else if (option == "--workers")
+    {
+        int64_t tmp_workers = strtol(value.c_str(), nullptr, 10);
+        if (tmp_workers >= 0)
+        {
+            m_num_sweep_workers = tmp_workers;
+            ret = true;
+        }
+    }
+    else if (option == "--metrics-socket")
+    {
+        m_metrics_socket_path = value;
+        ret = !value.empty();
+    }
+    else if (option == "--metrics-interval")
+    {
+        int64_t tmp_interval = strtol(value.c_str(), nullptr, 10);
+        if (tmp_interval >= 0)
+        {
+            m_metrics_summary_interval = tmp_interval;
+            ret = true;
+        }
+    }
+    else if (option == "--schedule")
+    {
+        m_adaptive_schedule = (value == "adaptive");
+        ret = (value == "adaptive" || value == "dynamic");
+    }
+    else if (option == "--pin-threads")
+    {
+        m_pin_threads = (value == "1");
+        ret = (value == "0" || value == "1");
+    }
+    else if (option == "--checkpoint-dir")
+    {
+        m_checkpoint_dir = value;
+        ret = !value.empty();
+    }
+    else if (option == "--checkpoint-interval")
+    {
+        int64_t tmp_interval = strtol(value.c_str(), nullptr, 10);
+        if (tmp_interval >= 0 && tmp_interval <= UINT32_MAX)
+        {
+            m_checkpoint_interval = tmp_interval;
+            ret = true;
+        }
+    }
+    else if (option == "--resume")
+    {
+        m_resume = (value == "1");
+        ret = (value == "0" || value == "1");
+    }
+    else if (option == "--port")
+    {
+        int64_t tmp_port = strtol(value.c_str(), nullptr, 10);
+        if (tmp_port > 0 && tmp_port <= UINT16_MAX)
+        {
+            m_transport_base_port = tmp_port;
+            ret = true;
+        }
+    }
 
     return ret;
 }
@@ -137,6 +420,41 @@ std::string falcon_simulation_environment_component_arg_parser::get_derived_clas
 
     ret << "  -d,--duration" << std::endl;
     ret << "                       simulation duration in seconds" << std::endl;
+    ret << "  -t,--threads" << std::endl;
+    ret << "                       number of worker threads (0 = one per hardware thread)" << std::endl;
+    ret << "  --rank" << std::endl;
+    ret << "                       rank of this process in a distributed simulation" << std::endl;
+    ret << "  --num-ranks" << std::endl;
+    ret << "                       number of processes in a distributed simulation" << std::endl;
+    ret << "  --hosts" << std::endl;
+    ret << "                       comma-separated host of every rank (default: loopback)" << std::endl;
+    ret << "  --port" << std::endl;
+    ret << "                       base TCP port; rank N listens on port + N" << std::endl;
+    ret << "  -s,--scenario" << std::endl;
+    ret << "                       name of the scenario to simulate (default: empty)" << std::endl;
+    ret << "  --sweep" << std::endl;
+    ret << "                       run the parameter sweep described by this file" << std::endl;
+    ret << "  --results" << std::endl;
+    ret << "                       sweep results file; an existing file is resumed" << std::endl;
+    ret << "  --workers" << std::endl;
+    ret << "                       number of sweep worker processes (0 = one per hardware thread)" << std::endl;
+    ret << "  --metrics-socket" << std::endl;
+    ret << "                       serve Prometheus metrics over HTTP on this Unix socket" << std::endl;
+    ret << "  --metrics-interval" << std::endl;
+    ret << "                       seconds between logged metrics summaries (0 = disabled)" << std::endl;
+    ret << "  --schedule" << std::endl;
+    ret << "                       dynamic: threads claim components in registration order (default)" << std::endl;
+    ret << "                       adaptive: assign components to threads from measured costs" << std::endl;
+    ret << "  --pin-threads" << std::endl;
+    ret << "                       1 to pin worker threads to CPUs in NUMA-aware order (default: 0);" << std::endl;
+    ret << "                       thread 0 is the thread that initializes and steps the simulation" << std::endl;
+    ret << "  --checkpoint-dir" << std::endl;
+    ret << "                       directory holding checkpoints (default: checkpoints)" << std::endl;
+    ret << "  --checkpoint-interval" << std::endl;
+    ret << "                       timesteps between checkpoints (0 = disabled)" << std::endl;
+    ret << "                       a checkpoint is skipped while the previous one is written" << std::endl;
+    ret << "  --resume" << std::endl;
+    ret << "                       1 to resume from the latest checkpoint (default: 0)" << std::endl;
     ret << std::endl;
 
     return ret.str();
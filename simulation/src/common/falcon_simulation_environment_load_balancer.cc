@@ -0,0 +1,393 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_load_balancer.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment cost-based load balancer.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements longest-processing-time-first wave planning with a locality
+ *  preference, makespan estimates used to compare plans, and discovery of a
+ *  NUMA-aware CPU order from sysfs.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added NUMA node lookup.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <dirent.h>
+#include <sched.h>
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "common/falcon_simulation_environment_load_balancer.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const char * const SYSFS_CPU_PATH = "/sys/devices/system/cpu";
+static const char * const SYSFS_NODE_PATH = "/sys/devices/system/node";
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/* placement attributes of a CPU; ordered for sorting */
+struct cpu_topology
+{
+    uint32_t    node;
+    uint32_t    cpu;
+    int64_t     package;
+    int64_t     core;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static int64_t read_sysfs_value(const std::string &path)
+{
+    std::ifstream input(path);
+    int64_t value = -1;
+
+    if (!(input >> value))
+    {
+        return -1;
+    }
+
+    return value;
+}
+
+/*
+ * @brief  Parses a kernel CPU list such as "0-3,8-11"
+ */
+static std::set<uint32_t> parse_cpu_list(const std::string &list)
+{
+    std::set<uint32_t> ret;
+    std::stringstream ss(list);
+    std::string range;
+
+    while (std::getline(ss, range, ','))
+    {
+        uint32_t first = 0;
+        uint32_t last = 0;
+        int num_parsed = sscanf(range.c_str(), "%u-%u", &first, &last);
+        if (num_parsed == 1)
+        {
+            last = first;
+        }
+
+        for (uint32_t cpu = first; num_parsed >= 1 && cpu <= last; ++cpu)
+        {
+            ret.insert(cpu);
+        }
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Maps every CPU to its NUMA node; empty if the system does not
+ *          expose NUMA topology
+ */
+static std::map<uint32_t, uint32_t> read_cpu_nodes(void)
+{
+    std::map<uint32_t, uint32_t> ret;
+
+    DIR *dir = opendir(SYSFS_NODE_PATH);
+    if (dir == nullptr)
+    {
+        return ret;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        uint32_t node = 0;
+        char trailing = 0;
+        if (sscanf(entry->d_name, "node%u%c", &node, &trailing) != 1)
+        {
+            continue;
+        }
+
+        std::ifstream input(std::string(SYSFS_NODE_PATH) + "/" + entry->d_name + "/cpulist");
+        std::string list;
+        std::getline(input, list);
+
+        for (auto cpu : parse_cpu_list(list))
+        {
+            ret[cpu] = node;
+        }
+    }
+
+    closedir(dir);
+
+    return ret;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_load_balancer::falcon_simulation_environment_load_balancer(void)
+  : m_num_threads(1)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_load_balancer::~falcon_simulation_environment_load_balancer(void)
+{
+    /* no action required at this time */
+}
+
+void falcon_simulation_environment_load_balancer::begin_plan(uint32_t num_threads)
+{
+    m_num_threads = std::max(num_threads, 1u);
+    m_key_threads.clear();
+}
+
+/*
+ * @brief  Assigns the tasks of one wave to threads
+ *
+ * @param[in]  tasks       Measured cost and locality keys of every task.
+ * @param[out] assignment  Task indices for each thread, most expensive first.
+ *
+ * @return Estimated makespan of the wave under the assignment.
+ */
+double falcon_simulation_environment_load_balancer::plan_wave(const std::vector<falcon_load_balancer_task> &tasks,
+                                                              FalconThreadTaskLists &assignment)
+{
+    assignment.assign(m_num_threads, std::vector<uint32_t>());
+
+    std::vector<uint32_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&tasks](uint32_t a, uint32_t b) { return tasks[a].cost > tasks[b].cost; });
+
+    double total_cost = 0.0;
+    for (auto &task : tasks)
+    {
+        total_cost += task.cost;
+    }
+
+    const double tolerance = FALCON_LOAD_BALANCER_LOCALITY_TOLERANCE * total_cost / m_num_threads;
+    std::vector<double> loads(m_num_threads, 0.0);
+
+    for (auto task_idx : order)
+    {
+        const falcon_load_balancer_task &task = tasks[task_idx];
+        const double min_load = *std::min_element(loads.begin(), loads.end());
+
+        uint32_t best_thread = 0;
+        int64_t best_score = -1;
+        for (uint32_t thread = 0; thread < m_num_threads; ++thread)
+        {
+            if (loads[thread] > min_load + tolerance)
+            {
+                continue;
+            }
+
+            int64_t score = 0;
+            for (auto key : task.locality_keys)
+            {
+                auto iter = m_key_threads.find(key);
+                score += (iter != m_key_threads.end()) ? iter->second[thread] : 0;
+            }
+
+            if (score > best_score || (score == best_score && loads[thread] < loads[best_thread]))
+            {
+                best_thread = thread;
+                best_score = score;
+            }
+        }
+
+        assignment[best_thread].push_back(task_idx);
+        loads[best_thread] += task.cost;
+
+        for (auto key : task.locality_keys)
+        {
+            std::vector<uint32_t> &key_threads = m_key_threads[key];
+            key_threads.resize(m_num_threads, 0);
+            key_threads[best_thread]++;
+        }
+    }
+
+    return *std::max_element(loads.begin(), loads.end());
+}
+
+/*
+ * @brief  Estimates the makespan of dynamic scheduling, where each thread
+ *          claims the next task in the given order as soon as it is free
+ */
+double falcon_simulation_environment_load_balancer::estimate_dynamic_makespan(const std::vector<double> &costs, uint32_t num_threads)
+{
+    std::priority_queue<double, std::vector<double>, std::greater<double>> thread_free_times;
+    for (uint32_t ii = 0; ii < std::max(num_threads, 1u); ++ii)
+    {
+        thread_free_times.push(0.0);
+    }
+
+    double ret = 0.0;
+    for (auto cost : costs)
+    {
+        double finish = thread_free_times.top() + cost;
+        thread_free_times.pop();
+        thread_free_times.push(finish);
+        ret = std::max(ret, finish);
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Estimates the makespan of an assignment, ignoring work stealing
+ */
+double falcon_simulation_environment_load_balancer::estimate_assigned_makespan(const std::vector<double> &costs,
+                                                                               const FalconThreadTaskLists &assignment)
+{
+    double ret = 0.0;
+    for (auto &tasks : assignment)
+    {
+        double load = 0.0;
+        for (auto task_idx : tasks)
+        {
+            load += costs[task_idx];
+        }
+        ret = std::max(ret, load);
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Orders the CPUs this process may run on for pinning worker threads
+ *
+ * The first CPU of every physical core comes first, grouped by NUMA node, and
+ *  is followed by the remaining SMT siblings, also grouped by node. Falls back
+ *  to numerical order where sysfs does not describe the topology.
+ */
+std::vector<uint32_t> falcon_simulation_environment_load_balancer::get_cpu_order(void)
+{
+    std::vector<uint32_t> ret;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    {
+        return ret;
+    }
+
+    std::map<uint32_t, uint32_t> cpu_nodes = read_cpu_nodes();
+    std::set<std::pair<int64_t, int64_t>> cores_seen;
+    std::vector<cpu_topology> primary;
+    std::vector<cpu_topology> siblings;
+
+    for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (!CPU_ISSET(cpu, &allowed))
+        {
+            continue;
+        }
+
+        std::string topology_path = std::string(SYSFS_CPU_PATH) + "/cpu" + std::to_string(cpu) + "/topology/";
+
+        cpu_topology topology;
+        topology.node = cpu_nodes.count(cpu) ? cpu_nodes[cpu] : 0;
+        topology.cpu = cpu;
+        topology.package = read_sysfs_value(topology_path + "physical_package_id");
+        topology.core = read_sysfs_value(topology_path + "core_id");
+
+        /* without topology information every CPU is its own core */
+        std::pair<int64_t, int64_t> core_key(topology.package, topology.core);
+        if (topology.core < 0)
+        {
+            core_key = std::pair<int64_t, int64_t>(-1 - static_cast<int64_t>(cpu), 0);
+        }
+        if (cores_seen.insert(core_key).second)
+        {
+            primary.push_back(topology);
+        }
+        else
+        {
+            siblings.push_back(topology);
+        }
+    }
+
+    auto by_node = [](const cpu_topology &a, const cpu_topology &b) { return std::tie(a.node, a.cpu) < std::tie(b.node, b.cpu); };
+    std::stable_sort(primary.begin(), primary.end(), by_node);
+    std::stable_sort(siblings.begin(), siblings.end(), by_node);
+
+    for (auto &topology : primary)
+    {
+        ret.push_back(topology.cpu);
+    }
+
+    for (auto &topology : siblings)
+    {
+        ret.push_back(topology.cpu);
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Returns the NUMA node of each CPU, or zero where the system does
+ *          not expose NUMA topology
+ */
+std::vector<uint32_t> falcon_simulation_environment_load_balancer::get_cpu_nodes(const std::vector<uint32_t> &cpus)
+{
+    std::map<uint32_t, uint32_t> cpu_nodes = read_cpu_nodes();
+    std::vector<uint32_t> ret;
+
+    for (auto cpu : cpus)
+    {
+        ret.push_back(cpu_nodes.count(cpu) ? cpu_nodes[cpu] : 0);
+    }
+
+    return ret;
+}
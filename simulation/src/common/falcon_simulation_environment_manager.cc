@@ -0,0 +1,1715 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_manager.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment manager implementation.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the FALCON simulation environment manager class that coordinates
+ *  component interaction while a simulation is executing. Components are
+ *  grouped into dependency levels ("waves") so that components without a
+ *  timestep advance dependency on each other are advanced concurrently.
+ *  Previous timestep dependencies are read from double-buffered state and do
+ *  not constrain the waves, so a scenario whose edges are all previous
+ *  timestep dependencies advances every component in a single wave.
+ *
+ * In distributed mode every rank registers and initializes the full set of
+ *  components, partitions the dependency graph identically, and advances only
+ *  its own partition. Components on the far side of a cut edge act as proxies
+ *  whose state is refreshed from the owning rank after each wave (timestep
+ *  advance dependencies) or after publication (previous timestep
+ *  dependencies). The timestep reward reduction doubles as the global
+ *  end-of-timestep barrier.
+ *
+ * Checkpoints are captured at the end of a timestep, once every component
+ *  has advanced and published, and written to disk by a background thread.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added double-buffered state publication.
+ * 19-Oct-2026  OrthogonalHawk  Added distributed simulation mode.
+ * 19-Oct-2026  OrthogonalHawk  Added single-step API, step buffers and
+ *                               snapshot/restore.
+ * 19-Oct-2026  OrthogonalHawk  Added per-trial configuration.
+ * 19-Oct-2026  OrthogonalHawk  Added live metrics.
+ * 19-Oct-2026  OrthogonalHawk  Added cost-based load balancing and thread
+ *                               pinning.
+ * 19-Oct-2026  OrthogonalHawk  Added asynchronous checkpoints and resume.
+ * 19-Oct-2026  OrthogonalHawk  Skip the publish batch for components without
+ *                               double-buffered state.
+ * 19-Oct-2026  OrthogonalHawk  Boundary state sizes in network byte order.
+ * 19-Oct-2026  OrthogonalHawk  Skip advance metrics that failed to register.
+ * 19-Oct-2026  OrthogonalHawk  Confine work stealing to a NUMA node once
+ *                               threads are pinned.
+ * 19-Oct-2026  OrthogonalHawk  Checkpoint only with empty channels and advanced
+ *                               components; vote on readiness in the reward
+ *                               reduction.
+ * 19-Oct-2026  OrthogonalHawk  Publish only components that declare double-buffered
+ *                               state.
+ * 19-Oct-2026  OrthogonalHawk  Documented that pinning is undone on shutdown.
+ * 19-Oct-2026  OrthogonalHawk  Fail the timestep when a component cannot complete it.
+ * 19-Oct-2026  OrthogonalHawk  Checkpoint the messages in flight on each channel.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <arpa/inet.h>
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_tcp_transport.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const char *OBSERVATIONS_RECORD = "observations";
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static std::string get_checkpoint_record_name(FalconComponentId id)
+{
+    std::stringstream ss;
+    ss << "component_" << id;
+    return ss.str();
+}
+
+static std::string get_channel_record_name(FalconChannelId id)
+{
+    std::stringstream ss;
+    ss << "channel_" << id;
+    return ss.str();
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+/* must be kept in sync with FALCON_MANAGER_STATE_ENUM */
+const char * falcon_simulation_environment_manager::manager_state_names[static_cast<uint32_t>(FALCON_MANAGER_STATE_ENUM::NUMBER_OF_STATES)] =
+{
+    "UNINITIALIZED",
+    "INITIALIZED",
+    "RUNNING_SIMULATION",
+    "SHUTDOWN_COMPLETE"
+};
+
+/* must be kept in sync with FALCON_MANAGER_STATUS_ENUM */
+const char * falcon_simulation_environment_manager::manager_status_names[static_cast<uint32_t>(FALCON_MANAGER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)] =
+{
+    "SUCCESS",
+    "INITIALIZATION_FAILED",
+    "UNSUPPORTED_TIMESTEP_ADVANCE_TIME",
+    "UNSUPPORTED_COMPONENT_DEPENDENCY",
+    "UNSUPPORTED_MANAGER_STATE_TRANSITION",
+    "COMPONENT_FAILURE",
+    "TRANSPORT_FAILURE"
+};
+
+falcon_simulation_environment_manager::falcon_simulation_environment_manager(void)
+  : m_manager_state(FALCON_MANAGER_STATE_ENUM::UNINITIALIZED),
+    m_channel_registry(std::make_shared<falcon_simulation_environment_channel_registry>()),
+    m_adaptive_schedule(false),
+    m_num_advanced_timesteps(0),
+    m_rank(0),
+    m_reward_reduction(2, 0),
+    m_snapshot_valid(false),
+    m_snapshot_timestep(0),
+    m_snapshot_cumulative_reward(0),
+    m_timesteps_metric(FALCON_METRICS_INVALID_ID),
+    m_timestep_duration_metric(FALCON_METRICS_INVALID_ID),
+    m_timestep_rate_metric(FALCON_METRICS_INVALID_ID),
+    m_current_timestep_metric(FALCON_METRICS_INVALID_ID),
+    m_timestep_reward_metric(FALCON_METRICS_INVALID_ID),
+    m_cumulative_reward_metric(FALCON_METRICS_INVALID_ID),
+    m_queue_depth_metric(FALCON_METRICS_INVALID_ID),
+    m_rate_window_timestep(0),
+    m_checkpoint_interval(0),
+    m_current_timestep(0),
+    m_timestep_reward(0),
+    m_cumulative_reward(0)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_manager::~falcon_simulation_environment_manager(void)
+{
+    /* the exporter samples the worker pool, so it must stop first */
+    m_metrics_exporter.shutdown();
+    m_worker_pool.shutdown();
+}
+
+/*
+ * @brief  Registers a component with the manager; must be called before initialize()
+ *
+ * The component identifier and initialization dependencies must already be
+ *  set, typically from the derived component constructor.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::add_component(std::shared_ptr<falcon_simulation_environment_component> component)
+{
+    if (m_manager_state != FALCON_MANAGER_STATE_ENUM::UNINITIALIZED || component == nullptr)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    FalconComponentId id = component->get_component_id();
+    if (m_components_by_id.find(id) != m_components_by_id.end())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Duplicate component id " << id;
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    m_components_by_id[id] = component;
+    m_active_components.push_back(component);
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Selects the transport for a distributed simulation; must be called
+ *          before initialize()
+ *
+ * If no transport is set and more than one rank is requested on the
+ *  command-line, a TCP transport is created from the command-line options.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::set_transport(std::shared_ptr<falcon_simulation_environment_transport> transport)
+{
+    if (m_manager_state != FALCON_MANAGER_STATE_ENUM::UNINITIALIZED)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+    }
+
+    m_transport = transport;
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Parses command-line arguments and initializes all registered components
+ *
+ * Components are initialized in initialization dependency order. Timestep
+ *  advance dependencies and message channels may be declared from within each
+ *  component's initialize() method; the timestep advance schedule is computed
+ *  once every component has been initialized.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::initialize(int argc, char ** pArgv)
+{
+    if (m_manager_state != FALCON_MANAGER_STATE_ENUM::UNINITIALIZED)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+    }
+
+    if (!m_arg_parser.parse_args(argc, pArgv))
+    {
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    FalconComponentSchedule initialization_levels;
+    FALCON_MANAGER_STATUS_ENUM ret = compute_dependency_levels(
+        &falcon_simulation_environment_component::get_initialization_dependency_ids, initialization_levels);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    for (auto &level : initialization_levels)
+    {
+        for (auto id : level)
+        {
+            std::shared_ptr<falcon_simulation_environment_component> component = m_components_by_id[id];
+            FalconComponentList dependencies = get_components(component->get_initialization_dependency_ids());
+
+            component->attach_channel_registry(m_channel_registry);
+
+            FALCON_COMPONENT_STATUS_ENUM component_ret = component->initialize(dependencies);
+            if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to initialize: "
+                                         << component->get_component_status_str(component_ret);
+                return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+            }
+        }
+    }
+
+    check_channel_endpoints();
+
+    ret = partition_components();
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    ret = build_timestep_advance_schedule();
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    allocate_step_buffers();
+
+    /* more threads than components would never have any work to do */
+    uint32_t num_threads = m_arg_parser.get_num_worker_threads();
+    if (num_threads == 0)
+    {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    size_t num_components = std::max(m_local_components.size(), static_cast<size_t>(1));
+
+    m_worker_pool.initialize(std::min(num_threads, static_cast<uint32_t>(num_components)));
+    m_adaptive_schedule = m_arg_parser.get_adaptive_schedule() && m_worker_pool.get_num_threads() > 1;
+
+    if (m_arg_parser.get_pin_threads())
+    {
+        pin_worker_threads();
+    }
+
+    ret = start_checkpoints();
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    ret = start_metrics();
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    return transition(FALCON_MANAGER_STATE_ENUM::INITIALIZED);
+}
+
+/*
+ * @brief  Runs the simulation for the duration requested on the command-line
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::run_simulation(void)
+{
+    FALCON_MANAGER_STATUS_ENUM ret = transition(FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    /* a resumed simulation continues from its checkpoint timestep */
+    uint64_t num_timesteps = m_arg_parser.get_simulation_duration_in_secs() * FALCON_MANAGER_TIMESTEPS_PER_SEC;
+    while (m_current_timestep < num_timesteps && ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        ret = advance_timestep();
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Simulation completed " << m_current_timestep << " timestep(s) with cumulative reward "
+                            << m_cumulative_reward;
+
+    return ret;
+}
+
+/*
+ * @brief  Advances the simulation by a single timestep
+ *
+ * Intended for external drivers such as reinforcement learning trainers that
+ *  write the action buffer before each call and read the observation and
+ *  reward buffers after it.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::step(void)
+{
+    if (m_manager_state != FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION)
+    {
+        FALCON_MANAGER_STATUS_ENUM ret = transition(FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION);
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    return advance_timestep();
+}
+
+/*
+ * @brief  Applies the seed and parameters of a sweep trial to every component
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::configure_trial(uint64_t seed, const FalconTrialParameters &parameters)
+{
+    for (auto &entry : m_components_by_id)
+    {
+        FALCON_COMPONENT_STATUS_ENUM component_ret = entry.second->configure_trial(seed, parameters);
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << entry.first << " failed to configure trial: "
+                                     << entry.second->get_component_status_str(component_ret);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Captures the state of every component at the current timestep
+ *          boundary so that it can later be restored with restore_snapshot()
+ *
+ * Requires every component to support state serialization.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::snapshot(void)
+{
+    if (m_manager_state != FALCON_MANAGER_STATE_ENUM::INITIALIZED &&
+        m_manager_state != FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+    }
+
+    m_snapshot_valid = false;
+
+    for (auto &entry : m_components_by_id)
+    {
+        FALCON_COMPONENT_STATUS_ENUM component_ret = entry.second->serialize_state(m_snapshot_states[entry.first]);
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << entry.first << " failed to serialize state: "
+                                     << entry.second->get_component_status_str(component_ret);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    m_snapshot_observations = m_observations;
+    m_snapshot_timestep = m_current_timestep;
+    m_snapshot_cumulative_reward = m_cumulative_reward;
+    m_snapshot_valid = true;
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Returns every component to the state captured by snapshot()
+ *
+ * Messages still queued on channels are discarded.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::restore_snapshot(void)
+{
+    if (!m_snapshot_valid)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+    }
+
+    for (auto &entry : m_components_by_id)
+    {
+        FALCON_COMPONENT_STATUS_ENUM component_ret = entry.second->deserialize_state(m_snapshot_states[entry.first]);
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << entry.first << " failed to deserialize state: "
+                                     << entry.second->get_component_status_str(component_ret);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    for (auto id : m_channel_registry->get_channel_ids())
+    {
+        m_channel_registry->find_channel(id)->clear();
+    }
+
+    /* assign() would reallocate if the sizes differed, but they never do */
+    std::copy(m_snapshot_observations.begin(), m_snapshot_observations.end(), m_observations.begin());
+    std::fill(m_component_rewards.begin(), m_component_rewards.end(), 0);
+    m_current_timestep = m_snapshot_timestep;
+    m_cumulative_reward = m_snapshot_cumulative_reward;
+    m_timestep_reward = 0;
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Shuts down all components in shutdown dependency order
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::shutdown(void)
+{
+    FalconComponentSchedule shutdown_levels;
+    FALCON_MANAGER_STATUS_ENUM ret = compute_dependency_levels(
+        &falcon_simulation_environment_component::get_shutdown_dependency_ids, shutdown_levels);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    /* waits for the last checkpoint to be written */
+    m_checkpoint_writer.shutdown();
+    m_metrics_exporter.shutdown();
+    m_worker_pool.shutdown();
+
+    for (auto &level : shutdown_levels)
+    {
+        for (auto id : level)
+        {
+            std::shared_ptr<falcon_simulation_environment_component> component = m_components_by_id[id];
+            FalconComponentList dependencies = get_components(component->get_shutdown_dependency_ids());
+
+            FALCON_COMPONENT_STATUS_ENUM component_ret = component->shutdown(dependencies);
+            if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to shutdown: "
+                                         << component->get_component_status_str(component_ret);
+                ret = FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+            }
+        }
+    }
+
+    if (m_transport != nullptr)
+    {
+        m_transport->shutdown();
+    }
+
+    FALCON_MANAGER_STATUS_ENUM transition_ret = transition(FALCON_MANAGER_STATE_ENUM::SHUTDOWN_COMPLETE);
+
+    return (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS) ? transition_ret : ret;
+}
+
+FALCON_MANAGER_STATE_ENUM falcon_simulation_environment_manager::get_manager_state(void)
+{
+    return m_manager_state;
+}
+
+uint32_t falcon_simulation_environment_manager::get_current_timestep(void)
+{
+    return m_current_timestep;
+}
+
+int32_t falcon_simulation_environment_manager::get_timestep_reward(void)
+{
+    return m_timestep_reward;
+}
+
+int64_t falcon_simulation_environment_manager::get_cumulative_reward(void)
+{
+    return m_cumulative_reward;
+}
+
+FalconObservationValue * falcon_simulation_environment_manager::get_observation_buffer(size_t &num_values)
+{
+    num_values = m_observations.size();
+    return m_observations.data();
+}
+
+FalconActionValue * falcon_simulation_environment_manager::get_action_buffer(size_t &num_values)
+{
+    num_values = m_actions.size();
+    return m_actions.data();
+}
+
+/*
+ * @brief  Per-component rewards for the most recent timestep, in component
+ *          registration order; entries for components owned by other ranks
+ *          are zero
+ */
+int32_t * falcon_simulation_environment_manager::get_reward_buffer(size_t &num_values)
+{
+    num_values = m_component_rewards.size();
+    return m_component_rewards.data();
+}
+
+const char * falcon_simulation_environment_manager::get_manager_state_str(FALCON_MANAGER_STATE_ENUM state) const
+{
+    /* assumes that UNINITIALIZED is the first valid state */
+    if (state >= FALCON_MANAGER_STATE_ENUM::UNINITIALIZED &&
+        state <  FALCON_MANAGER_STATE_ENUM::NUMBER_OF_STATES)
+    {
+        return manager_state_names[static_cast<uint32_t>(state)];
+    }
+
+    return nullptr;
+}
+
+const char * falcon_simulation_environment_manager::get_manager_status_str(FALCON_MANAGER_STATUS_ENUM status_code) const
+{
+    /* assumes that SUCCESS is the first valid status */
+    if (status_code >= FALCON_MANAGER_STATUS_ENUM::SUCCESS &&
+        status_code <  FALCON_MANAGER_STATUS_ENUM::NUMBER_OF_STATUS_CODES)
+    {
+        return manager_status_names[static_cast<uint32_t>(status_code)];
+    }
+
+    return nullptr;
+}
+
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::transition(FALCON_MANAGER_STATE_ENUM new_state)
+{
+    FALCON_MANAGER_STATUS_ENUM ret = FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+
+    switch (new_state)
+    {
+    case FALCON_MANAGER_STATE_ENUM::INITIALIZED:
+        if (m_manager_state != FALCON_MANAGER_STATE_ENUM::UNINITIALIZED)
+        {
+            ret = FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+        }
+        break;
+
+    case FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION:
+        if (m_manager_state != FALCON_MANAGER_STATE_ENUM::INITIALIZED &&
+            m_manager_state != FALCON_MANAGER_STATE_ENUM::RUNNING_SIMULATION)
+        {
+            ret = FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+        }
+        break;
+
+    case FALCON_MANAGER_STATE_ENUM::SHUTDOWN_COMPLETE:
+        /* once the SHUTDOWN_COMPLETE state has been entered it cannot be left */
+        if (m_manager_state == FALCON_MANAGER_STATE_ENUM::SHUTDOWN_COMPLETE)
+        {
+            ret = FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+        }
+        break;
+
+    case FALCON_MANAGER_STATE_ENUM::UNINITIALIZED:
+    default:
+        ret = FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION;
+        break;
+    }
+
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        m_manager_state = new_state;
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Groups components into levels such that every component's
+ *          dependencies are in a strictly earlier level
+ *
+ * @param  get_dependency_ids Component method that returns the dependency set
+ *                             to order by.
+ * @param  levels             Resulting component levels.
+ *
+ * @return SUCCESS, or UNSUPPORTED_COMPONENT_DEPENDENCY if a dependency does not
+ *          exist or the dependencies are cyclic.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::compute_dependency_levels(FalconDependencyIdGetter get_dependency_ids, FalconComponentSchedule &levels)
+{
+    std::map<FalconComponentId, uint32_t> num_unresolved;
+    std::map<FalconComponentId, FalconComponentIdList> dependents;
+
+    levels.clear();
+
+    for (auto &entry : m_components_by_id)
+    {
+        FalconComponentIdList dependency_ids = (entry.second.get()->*get_dependency_ids)();
+        for (auto dependency_id : dependency_ids)
+        {
+            if (m_components_by_id.find(dependency_id) == m_components_by_id.end())
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << entry.first << " depends on unknown component " << dependency_id;
+                return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_COMPONENT_DEPENDENCY;
+            }
+
+            dependents[dependency_id].push_back(entry.first);
+        }
+
+        num_unresolved[entry.first] = static_cast<uint32_t>(dependency_ids.size());
+    }
+
+    FalconComponentIdList ready;
+    for (auto &entry : num_unresolved)
+    {
+        if (entry.second == 0)
+        {
+            ready.push_back(entry.first);
+        }
+    }
+
+    size_t num_scheduled = 0;
+    while (!ready.empty())
+    {
+        FalconComponentIdList next_ready;
+        for (auto id : ready)
+        {
+            for (auto dependent_id : dependents[id])
+            {
+                if (--num_unresolved[dependent_id] == 0)
+                {
+                    next_ready.push_back(dependent_id);
+                }
+            }
+        }
+
+        num_scheduled += ready.size();
+        levels.push_back(ready);
+        ready.swap(next_ready);
+    }
+
+    if (num_scheduled != m_components_by_id.size())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Cyclic component dependencies detected";
+        return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_COMPONENT_DEPENDENCY;
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+FalconComponentList falcon_simulation_environment_manager::get_components(FalconComponentIdList ids)
+{
+    FalconComponentList ret;
+    for (auto id : ids)
+    {
+        ret.push_back(m_components_by_id[id]);
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Warns about channels that are missing a producer or a consumer
+ */
+void falcon_simulation_environment_manager::check_channel_endpoints(void)
+{
+    for (auto id : m_channel_registry->get_channel_ids())
+    {
+        std::shared_ptr<falcon_simulation_environment_channel_base> channel = m_channel_registry->find_channel(id);
+
+        if (channel->get_num_producers() == 0)
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Channel " << id << " has no producer";
+        }
+
+        if (!channel->has_consumer())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Channel " << id << " has no consumer";
+        }
+    }
+}
+
+/*
+ * @brief  Computes the timestep advance waves
+ *
+ * Message channels and previous timestep dependencies do not constrain the
+ *  schedule; both only expose data produced during an earlier timestep, so
+ *  the components on either side of such an edge may share a wave.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::build_timestep_advance_schedule(void)
+{
+    FalconComponentSchedule levels;
+    FALCON_MANAGER_STATUS_ENUM ret = compute_dependency_levels(
+        &falcon_simulation_environment_component::get_timestep_advance_dependency_ids, levels);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    /* every rank keeps every wave, even if it holds no local component in
+     *  it, so that boundary exchanges line up across ranks */
+    std::map<FalconComponentId, uint32_t> component_waves;
+
+    m_timestep_advance_waves.clear();
+    m_local_components.clear();
+    for (auto &level : levels)
+    {
+        std::vector<component_schedule_entry> wave;
+        for (auto id : level)
+        {
+            component_waves[id] = static_cast<uint32_t>(m_timestep_advance_waves.size());
+            if (m_component_ranks[id] != m_rank)
+            {
+                continue;
+            }
+
+            component_schedule_entry entry;
+            entry.component = m_components_by_id[id];
+            entry.status = FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+            entry.advance_metric = FALCON_METRICS_INVALID_ID;
+            entry.sampled_ns = 0;
+            entry.cost_ns = 0.0;
+
+            /* components receive both kinds of dependency; an edge declared
+             *  as both is treated as a timestep advance dependency */
+            FalconComponentIdList dependency_ids = entry.component->get_timestep_advance_dependency_ids();
+            for (auto previous_id : entry.component->get_previous_timestep_dependency_ids())
+            {
+                if (m_components_by_id.find(previous_id) == m_components_by_id.end())
+                {
+                    BOOST_LOG_TRIVIAL(error) << "Component " << id << " depends on unknown component " << previous_id;
+                    return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_COMPONENT_DEPENDENCY;
+                }
+
+                if (std::find(dependency_ids.begin(), dependency_ids.end(), previous_id) == dependency_ids.end())
+                {
+                    dependency_ids.push_back(previous_id);
+                }
+            }
+
+            entry.timestep_advance_dependencies = get_components(dependency_ids);
+            wave.push_back(entry);
+            m_local_components.push_back(entry.component);
+        }
+
+        m_timestep_advance_waves.push_back(wave);
+    }
+
+    m_wave_exchanges.assign(m_timestep_advance_waves.size(), boundary_exchange());
+    m_publish_exchange = boundary_exchange();
+    add_boundary_edges(&falcon_simulation_environment_component::get_timestep_advance_dependency_ids, component_waves, true);
+    add_boundary_edges(&falcon_simulation_environment_component::get_previous_timestep_dependency_ids, component_waves, false);
+
+    /* with no component holding double-buffered state no publish batch is
+     *  dispatched at all */
+    m_publish_components.clear();
+    for (auto &component : m_local_components)
+    {
+        if (component->uses_double_buffered_state())
+        {
+            m_publish_components.push_back(component);
+        }
+    }
+    m_publish_status.assign(m_publish_components.size(), FALCON_COMPONENT_STATUS_ENUM::SUCCESS);
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Allocates the observation, action and reward buffers and hands each
+ *          component its slices
+ */
+void falcon_simulation_environment_manager::allocate_step_buffers(void)
+{
+    size_t num_observations = 0;
+    size_t num_actions = 0;
+    for (auto &component : m_active_components)
+    {
+        num_observations += component->get_observation_size();
+        num_actions += component->get_action_size();
+    }
+
+    m_observations.assign(num_observations, 0);
+    m_actions.assign(num_actions, 0);
+    m_component_rewards.assign(m_active_components.size(), 0);
+
+    std::map<FalconComponentId, int32_t *> reward_slots;
+    size_t observation_offset = 0;
+    size_t action_offset = 0;
+    size_t reward_offset = 0;
+
+    for (auto &component : m_active_components)
+    {
+        component->attach_step_buffers(m_observations.data() + observation_offset, m_actions.data() + action_offset);
+        reward_slots[component->get_component_id()] = m_component_rewards.data() + reward_offset;
+
+        observation_offset += component->get_observation_size();
+        action_offset += component->get_action_size();
+        reward_offset++;
+    }
+
+    m_local_reward_slots.clear();
+    for (auto &component : m_local_components)
+    {
+        m_local_reward_slots.push_back(reward_slots[component->get_component_id()]);
+    }
+}
+
+/*
+ * @brief  Advances every component by a single timestep and collects rewards
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::advance_timestep(void)
+{
+    falcon_simulation_environment_metrics *metrics = m_metrics.get();
+    const bool profile = m_adaptive_schedule &&
+                         (m_num_advanced_timesteps < FALCON_MANAGER_PROFILE_WARMUP_TIMESTEPS ||
+                          m_num_advanced_timesteps % FALCON_MANAGER_PROFILE_INTERVAL == 0);
+    std::chrono::steady_clock::time_point timestep_start;
+    if (metrics != nullptr)
+    {
+        timestep_start = std::chrono::steady_clock::now();
+    }
+
+    for (auto &component : m_local_components)
+    {
+        FALCON_COMPONENT_STATUS_ENUM component_ret = component->next_timestep_started();
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << component->get_component_id() << " failed to start timestep "
+                                     << m_current_timestep << ": " << component->get_component_status_str(component_ret);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    for (size_t wave_idx = 0; wave_idx < m_timestep_advance_waves.size(); ++wave_idx)
+    {
+        std::vector<component_schedule_entry> &wave = m_timestep_advance_waves[wave_idx];
+        const uint32_t current_timestep = m_current_timestep;
+
+        auto advance = [&wave, current_timestep, metrics, profile](uint32_t idx) {
+            component_schedule_entry &entry = wave[idx];
+
+            /* each component receives its own copy so that no component can
+             *  disturb the timestep seen by the others in its wave */
+            uint32_t timestep = current_timestep;
+            if (metrics == nullptr && !profile)
+            {
+                entry.status = entry.component->advance_timestep(timestep, entry.timestep_advance_dependencies);
+                return;
+            }
+
+            auto advance_start = std::chrono::steady_clock::now();
+            entry.status = entry.component->advance_timestep(timestep, entry.timestep_advance_dependencies);
+            uint64_t advance_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - advance_start).count();
+
+            entry.sampled_ns = advance_ns;
+            /* the nanosecond counter is registered right after the count */
+            if (metrics != nullptr && entry.advance_metric != FALCON_METRICS_INVALID_ID)
+            {
+                metrics->add(entry.advance_metric, 1);
+                metrics->add(entry.advance_metric + 1, advance_ns);
+            }
+        };
+
+        if (m_wave_assignments.empty())
+        {
+            m_worker_pool.parallel_for(static_cast<uint32_t>(wave.size()), advance);
+        }
+        else
+        {
+            m_worker_pool.parallel_for_assigned(m_wave_assignments[wave_idx], advance);
+        }
+
+        for (auto &entry : wave)
+        {
+            if (entry.status != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << entry.component->get_component_id() << " failed to advance timestep "
+                                         << m_current_timestep << ": " << entry.component->get_component_status_str(entry.status);
+                return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+            }
+
+            FALCON_COMPONENT_STATUS_ENUM completed_ret = entry.component->timestep_advance_completed();
+            if (completed_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << entry.component->get_component_id() << " failed to complete timestep "
+                                         << m_current_timestep << ": " << entry.component->get_component_status_str(completed_ret);
+                return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+            }
+        }
+
+        FALCON_MANAGER_STATUS_ENUM ret = exchange_boundary_state(m_wave_exchanges[wave_idx]);
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    FALCON_MANAGER_STATUS_ENUM ret = publish_timestep_state();
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    ret = exchange_boundary_state(m_publish_exchange);
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        return ret;
+    }
+
+    /* ranks vote on checkpoint readiness in the reward reduction rather
+     *  than in a reduction of their own */
+    const bool checkpoint_due = m_checkpoint_interval > 0 && (m_current_timestep + 1) % m_checkpoint_interval == 0;
+    const bool checkpoint_ready = !checkpoint_due || is_checkpoint_ready(m_current_timestep + 1);
+
+    m_reward_reduction[0] = 0;
+    m_reward_reduction[1] = checkpoint_ready ? 0 : 1;
+
+    auto reward_slot = m_local_reward_slots.begin();
+    for (auto &component : m_local_components)
+    {
+        int32_t reward = component->get_timestep_reward();
+        **reward_slot++ = reward;
+        m_reward_reduction[0] += reward;
+    }
+
+    if (m_transport != nullptr && !m_transport->all_reduce_sum(m_reward_reduction))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " failed to reduce the reward for timestep " << m_current_timestep;
+        return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+    }
+
+    m_timestep_reward = static_cast<int32_t>(m_reward_reduction[0]);
+
+    m_cumulative_reward += m_timestep_reward;
+    m_current_timestep++;
+
+    if (metrics != nullptr)
+    {
+        update_timestep_metrics(timestep_start);
+    }
+
+    if (profile)
+    {
+        update_component_costs();
+    }
+    m_num_advanced_timesteps++;
+
+    if (checkpoint_due && m_reward_reduction[1] == 0)
+    {
+        capture_checkpoint();
+    }
+    else if (checkpoint_due && checkpoint_ready)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Rank " << m_rank << " skipped checkpoint at timestep " << m_current_timestep
+                                   << " because another rank was not ready";
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Pins the worker threads, including the thread that initialized the
+ *          manager, to CPUs in NUMA-aware order
+ *
+ * The initializing thread is pinned as thread zero, which executes its share
+ *  of every batch, so it should also be the thread that steps the simulation.
+ *  Its previous affinity is restored when the manager shuts down.
+ *  Work stealing is then confined to threads on the same NUMA node, so that
+ *  an adaptive schedule's placement is not undone across nodes.
+ */
+void falcon_simulation_environment_manager::pin_worker_threads(void)
+{
+    std::vector<uint32_t> cpus = falcon_simulation_environment_load_balancer::get_cpu_order();
+    if (!m_worker_pool.pin_threads(cpus))
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Unable to pin worker threads to CPUs";
+        return;
+    }
+
+    std::vector<uint32_t> cpu_nodes = falcon_simulation_environment_load_balancer::get_cpu_nodes(cpus);
+    std::vector<uint32_t> thread_nodes;
+    std::stringstream ss;
+    for (uint32_t ii = 0; ii < m_worker_pool.get_num_threads(); ++ii)
+    {
+        thread_nodes.push_back(cpu_nodes[ii % cpus.size()]);
+        ss << (ii == 0 ? "" : ",") << cpus[ii % cpus.size()];
+    }
+
+    m_worker_pool.set_steal_groups(thread_nodes);
+
+    BOOST_LOG_TRIVIAL(info) << "Pinned " << m_worker_pool.get_num_threads() << " worker thread(s) to CPU(s) " << ss.str();
+}
+
+/*
+ * @brief  Folds the advance times measured on a profiled timestep into the
+ *          component cost averages, and plans or re-plans the schedule once
+ *          the warmup timesteps have been measured
+ */
+void falcon_simulation_environment_manager::update_component_costs(void)
+{
+    for (auto &wave : m_timestep_advance_waves)
+    {
+        for (auto &entry : wave)
+        {
+            entry.cost_ns = (m_num_advanced_timesteps == 0) ? entry.sampled_ns :
+                FALCON_MANAGER_COST_EWMA_WEIGHT * entry.sampled_ns + (1.0 - FALCON_MANAGER_COST_EWMA_WEIGHT) * entry.cost_ns;
+        }
+    }
+
+    if (m_num_advanced_timesteps + 1 >= FALCON_MANAGER_PROFILE_WARMUP_TIMESTEPS)
+    {
+        rebalance_schedule();
+    }
+}
+
+/*
+ * @brief  Plans the assignment of components to worker threads from their
+ *          measured costs
+ *
+ * The first plan is always adopted. Later plans replace the current one only
+ *  if, under the latest costs, they are estimated to shorten the timestep by
+ *  at least FALCON_MANAGER_REPLAN_THRESHOLD, which keeps components on the
+ *  same threads while costs are stable.
+ */
+void falcon_simulation_environment_manager::rebalance_schedule(void)
+{
+    const uint32_t num_threads = m_worker_pool.get_num_threads();
+    std::vector<FalconThreadTaskLists> assignments(m_timestep_advance_waves.size());
+    double planned_ns = 0.0;
+    double current_ns = 0.0;
+    double naive_ns = 0.0;
+
+    m_load_balancer.begin_plan(num_threads);
+    for (size_t wave_idx = 0; wave_idx < m_timestep_advance_waves.size(); ++wave_idx)
+    {
+        std::vector<falcon_load_balancer_task> tasks;
+        std::vector<double> costs;
+        for (auto &entry : m_timestep_advance_waves[wave_idx])
+        {
+            falcon_load_balancer_task task;
+            task.cost = entry.cost_ns;
+            task.locality_keys.push_back(entry.component->get_component_id());
+            for (auto &dependency : entry.timestep_advance_dependencies)
+            {
+                task.locality_keys.push_back(dependency->get_component_id());
+            }
+
+            tasks.push_back(task);
+            costs.push_back(entry.cost_ns);
+        }
+
+        planned_ns += m_load_balancer.plan_wave(tasks, assignments[wave_idx]);
+        naive_ns += falcon_simulation_environment_load_balancer::estimate_dynamic_makespan(costs, num_threads);
+        if (!m_wave_assignments.empty())
+        {
+            current_ns += falcon_simulation_environment_load_balancer::estimate_assigned_makespan(costs, m_wave_assignments[wave_idx]);
+        }
+    }
+
+    if (m_wave_assignments.empty())
+    {
+        BOOST_LOG_TRIVIAL(info) << "Planned schedule on " << num_threads << " thread(s) from measured costs: estimated "
+                                << planned_ns / 1000.0 << " us per timestep vs " << naive_ns / 1000.0
+                                << " us in registration order (" << ((planned_ns > 0.0) ? naive_ns / planned_ns : 1.0) << "x)";
+    }
+    else if (current_ns > planned_ns * (1.0 + FALCON_MANAGER_REPLAN_THRESHOLD))
+    {
+        BOOST_LOG_TRIVIAL(info) << "Re-planned schedule at timestep " << m_current_timestep << " after component costs drifted: estimated "
+                                << current_ns / 1000.0 << " -> " << planned_ns / 1000.0 << " us per timestep ("
+                                << naive_ns / 1000.0 << " us in registration order)";
+    }
+    else
+    {
+        return;
+    }
+
+    m_wave_assignments.swap(assignments);
+}
+
+/*
+ * @brief  Registers the simulation metrics and starts the exporter, if either
+ *          the metrics endpoint or the periodic summary was requested
+ *
+ * Metrics are registered once the schedule is known, so every component
+ *  advanced by this rank has a latency series.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::start_metrics(void)
+{
+    if (m_arg_parser.get_metrics_socket_path().empty() && m_arg_parser.get_metrics_summary_interval_in_secs() == 0)
+    {
+        return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+    }
+
+    const uint32_t num_state_metrics = static_cast<uint32_t>(FALCON_COMPONENT_STATE_ENUM::NUMBER_OF_STATES);
+    FalconChannelIdList channel_ids = m_channel_registry->get_channel_ids();
+
+    m_metrics = std::make_shared<falcon_simulation_environment_metrics>(
+        FALCON_METRICS_DEFAULT_CAPACITY + num_state_metrics + 2 * m_local_components.size() + channel_ids.size());
+
+    m_timesteps_metric = m_metrics->register_counter("falcon_timesteps_total", "", "Timesteps completed.");
+    m_timestep_duration_metric = m_metrics->register_counter("falcon_timestep_nanoseconds_total", "",
+                                                             "Wall time spent advancing timesteps.");
+    m_timestep_rate_metric = m_metrics->register_gauge("falcon_timesteps_per_second", "",
+                                                       "Timesteps completed per second of wall time.");
+    m_current_timestep_metric = m_metrics->register_gauge("falcon_current_timestep", "", "Current simulation timestep.");
+    m_timestep_reward_metric = m_metrics->register_gauge("falcon_timestep_reward", "", "Reward of the last timestep.");
+    m_cumulative_reward_metric = m_metrics->register_gauge("falcon_cumulative_reward", "", "Cumulative reward.");
+
+    falcon_simulation_environment_worker_pool *worker_pool = &m_worker_pool;
+    m_queue_depth_metric = m_metrics->register_sampled_gauge("falcon_worker_pool_queue_depth", "",
+        "Tasks of the current wave not yet claimed by a worker thread.",
+        [worker_pool]{ return static_cast<double>(worker_pool->get_queue_depth()); });
+    m_metrics->register_sampled_gauge("falcon_worker_pool_threads", "", "Threads advancing components.",
+        [worker_pool]{ return static_cast<double>(worker_pool->get_num_threads()); });
+
+    /* the state gauges must be consecutive, in FALCON_COMPONENT_STATE_ENUM order */
+    if (!m_components_by_id.empty())
+    {
+        std::shared_ptr<falcon_simulation_environment_component> first_component = m_components_by_id.begin()->second;
+
+        FalconMetricId state_metric_base = FALCON_METRICS_INVALID_ID;
+        for (uint32_t state = 0; state < num_state_metrics; ++state)
+        {
+            const char *state_name = first_component->get_component_state_str(static_cast<FALCON_COMPONENT_STATE_ENUM>(state));
+            FalconMetricId id = m_metrics->register_gauge("falcon_component_state", std::string("state=\"") + state_name + "\"",
+                                                          "Components in each component state.");
+            state_metric_base = (state == 0) ? id : state_metric_base;
+        }
+
+        for (auto &entry : m_components_by_id)
+        {
+            entry.second->attach_metrics(m_metrics, state_metric_base);
+        }
+    }
+
+    for (auto &wave : m_timestep_advance_waves)
+    {
+        for (auto &entry : wave)
+        {
+            std::string labels = "component=\"" + std::to_string(entry.component->get_component_id()) + "\"";
+            entry.advance_metric = m_metrics->register_counter("falcon_component_advances_total", labels,
+                                                               "Timestep advances completed by each component.");
+            m_metrics->register_counter("falcon_component_advance_nanoseconds_total", labels,
+                                        "Wall time spent advancing each component.");
+        }
+    }
+
+    for (auto id : channel_ids)
+    {
+        std::shared_ptr<falcon_simulation_environment_channel_base> channel = m_channel_registry->find_channel(id);
+        m_metrics->register_sampled_gauge("falcon_channel_queue_depth", "channel=\"" + std::to_string(id) + "\"",
+            "Messages queued on each channel.",
+            [channel]{ return static_cast<double>(channel->get_queue_depth()); });
+    }
+
+    m_rate_window_start = std::chrono::steady_clock::now();
+    m_rate_window_timestep = m_current_timestep;
+
+    if (!m_metrics_exporter.initialize(m_metrics, m_arg_parser.get_metrics_socket_path(),
+                                       m_arg_parser.get_metrics_summary_interval_in_secs(),
+                                       [this]{ return get_metrics_summary(); }))
+    {
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Publishes the per-timestep metrics; called by the stepping thread
+ *          at the end of every timestep
+ */
+void falcon_simulation_environment_manager::update_timestep_metrics(std::chrono::steady_clock::time_point timestep_start)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    m_metrics->add(m_timesteps_metric, 1);
+    m_metrics->add(m_timestep_duration_metric, std::chrono::duration_cast<std::chrono::nanoseconds>(now - timestep_start).count());
+    m_metrics->set(m_current_timestep_metric, m_current_timestep);
+    m_metrics->set(m_timestep_reward_metric, m_timestep_reward);
+    m_metrics->set(m_cumulative_reward_metric, static_cast<double>(m_cumulative_reward));
+
+    /* a restored snapshot moves the timestep backwards */
+    if (m_current_timestep < m_rate_window_timestep)
+    {
+        m_rate_window_start = timestep_start;
+        m_rate_window_timestep = m_current_timestep - 1;
+    }
+
+    std::chrono::duration<double> window = now - m_rate_window_start;
+    if (window >= std::chrono::milliseconds(FALCON_MANAGER_METRICS_RATE_WINDOW_MS))
+    {
+        m_metrics->set(m_timestep_rate_metric, (m_current_timestep - m_rate_window_timestep) / window.count());
+        m_rate_window_start = now;
+        m_rate_window_timestep = m_current_timestep;
+    }
+}
+
+/*
+ * @brief  One line summary for the log; called on the exporter thread, so it
+ *          only reads the metrics registry
+ */
+std::string falcon_simulation_environment_manager::get_metrics_summary(void)
+{
+    std::stringstream ss;
+    ss << "Metrics: timestep " << static_cast<int64_t>(m_metrics->read(m_current_timestep_metric))
+       << ", " << m_metrics->read(m_timestep_rate_metric) << " timesteps/sec"
+       << ", cumulative reward " << static_cast<int64_t>(m_metrics->read(m_cumulative_reward_metric))
+       << ", queue depth " << static_cast<int64_t>(m_metrics->read(m_queue_depth_metric));
+
+    /* the component with the highest mean advance latency */
+    FalconComponentId slowest_id = 0;
+    double slowest_ns = -1.0;
+    for (auto &wave : m_timestep_advance_waves)
+    {
+        for (auto &entry : wave)
+        {
+            if (entry.advance_metric == FALCON_METRICS_INVALID_ID)
+            {
+                continue;
+            }
+
+            double num_advances = m_metrics->read(entry.advance_metric);
+            double mean_ns = (num_advances > 0.0) ? m_metrics->read(entry.advance_metric + 1) / num_advances : 0.0;
+            if (mean_ns > slowest_ns)
+            {
+                slowest_id = entry.component->get_component_id();
+                slowest_ns = mean_ns;
+            }
+        }
+    }
+
+    if (slowest_ns >= 0.0)
+    {
+        ss << ", slowest component " << slowest_id << " (" << slowest_ns / 1000.0 << " us/advance)";
+    }
+
+    return ss.str();
+}
+
+/*
+ * @brief  Resumes from the latest checkpoint, if requested, and starts the
+ *          checkpoint writer, if checkpoints were requested
+ *
+ * In distributed mode each rank checkpoints its own components to files
+ *  prefixed with its rank.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::start_checkpoints(void)
+{
+    m_checkpoint_interval = m_arg_parser.get_checkpoint_interval_in_timesteps();
+
+    if (m_transport != nullptr)
+    {
+        std::stringstream ss;
+        ss << "rank" << m_rank << "_";
+        m_checkpoint_prefix = ss.str();
+    }
+
+    if (m_arg_parser.get_resume())
+    {
+        FALCON_MANAGER_STATUS_ENUM ret = resume_from_checkpoint();
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    if (m_checkpoint_interval > 0 &&
+        !m_checkpoint_writer.initialize(m_arg_parser.get_checkpoint_dir(), m_checkpoint_prefix))
+    {
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Restores every local component, the messages in flight on each
+ *          channel, the observations and the timestep counters from the
+ *          latest checkpoint
+ *
+ * Every rank must resume from the same timestep. Proxy components are then
+ *  refreshed from their owning ranks, as they are after each publication.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::resume_from_checkpoint(void)
+{
+    if (!m_checkpoint_writer.load(m_arg_parser.get_checkpoint_dir(), m_checkpoint_prefix, m_checkpoint))
+    {
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    for (auto &component : m_local_components)
+    {
+        FalconComponentId id = component->get_component_id();
+        auto record = m_checkpoint.records.find(get_checkpoint_record_name(id));
+        if (record == m_checkpoint.records.end())
+        {
+            BOOST_LOG_TRIVIAL(error) << "Checkpoint has no state for component " << id;
+            return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+        }
+
+        FALCON_COMPONENT_STATUS_ENUM component_ret = component->deserialize_state(record->second);
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to deserialize state: "
+                                     << component->get_component_status_str(component_ret);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    for (auto id : m_channel_registry->get_channel_ids())
+    {
+        auto record = m_checkpoint.records.find(get_channel_record_name(id));
+        if (record == m_checkpoint.records.end())
+        {
+            BOOST_LOG_TRIVIAL(error) << "Checkpoint has no messages for channel " << id;
+            return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+        }
+
+        if (!m_channel_registry->find_channel(id)->deserialize(record->second))
+        {
+            BOOST_LOG_TRIVIAL(error) << "Checkpoint messages for channel " << id << " do not match its producers";
+            return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+        }
+    }
+
+    const FalconStateBuffer &observations = m_checkpoint.records[OBSERVATIONS_RECORD];
+    if (observations.size() != m_observations.size() * sizeof(FalconObservationValue))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Checkpoint observations do not match the registered components";
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+    memcpy(m_observations.data(), observations.data(), observations.size());
+
+    if (m_transport != nullptr)
+    {
+        std::vector<int64_t> rank_timesteps(m_transport->get_num_ranks(), 0);
+        rank_timesteps[m_rank] = m_checkpoint.timestep;
+
+        if (!m_transport->all_reduce_sum(rank_timesteps))
+        {
+            return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+        }
+
+        for (auto timestep : rank_timesteps)
+        {
+            if (timestep != m_checkpoint.timestep)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " checkpoint is for timestep " << m_checkpoint.timestep
+                                         << " but another rank's is for timestep " << timestep;
+                return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+            }
+        }
+
+        FALCON_MANAGER_STATUS_ENUM ret = exchange_boundary_state(m_publish_exchange);
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    m_current_timestep = m_checkpoint.timestep;
+    m_cumulative_reward = m_checkpoint.cumulative_reward;
+    m_timestep_reward = 0;
+
+    BOOST_LOG_TRIVIAL(info) << "Resumed from checkpoint at timestep " << m_current_timestep
+                            << " with cumulative reward " << m_cumulative_reward;
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Indicates whether a checkpoint can be captured at the end of the
+ *          timestep being advanced
+ *
+ * A checkpoint that is still being written is never waited for, and the new
+ *  one is skipped instead.
+ */
+bool falcon_simulation_environment_manager::is_checkpoint_ready(uint32_t timestep)
+{
+    if (m_checkpoint_writer.is_busy())
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Skipped checkpoint at timestep " << timestep
+                                   << " while the previous checkpoint is still being written";
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * @brief  Captures local component state and the messages in flight on each
+ *          channel at the current timestep boundary and hands them to the
+ *          checkpoint writer
+ *
+ * Called once every component has completed and published the timestep and
+ *  every rank has reported itself ready; advance_timestep() fails the step
+ *  before reaching here if any component could not complete, so the captured
+ *  state is consistent and the ranks always hold checkpoints for the same
+ *  timestep. Messages keep their timestep stamps, so a resumed consumer sees
+ *  each one in the same timestep as it would have. Only serialization happens
+ *  on the stepping thread.
+ */
+void falcon_simulation_environment_manager::capture_checkpoint(void)
+{
+    m_checkpoint.timestep = m_current_timestep;
+    m_checkpoint.cumulative_reward = m_cumulative_reward;
+
+    for (auto &component : m_local_components)
+    {
+        FalconComponentId id = component->get_component_id();
+        FALCON_COMPONENT_STATUS_ENUM component_ret = component->serialize_state(m_checkpoint.records[get_checkpoint_record_name(id)]);
+        if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to serialize state; checkpoints disabled: "
+                                     << component->get_component_status_str(component_ret);
+            m_checkpoint_interval = 0;
+            return;
+        }
+    }
+
+    for (auto id : m_channel_registry->get_channel_ids())
+    {
+        if (!m_channel_registry->find_channel(id)->serialize(m_checkpoint.records[get_channel_record_name(id)]))
+        {
+            BOOST_LOG_TRIVIAL(error) << "Channel " << id << " messages are not trivially copyable; checkpoints disabled";
+            m_checkpoint_interval = 0;
+            return;
+        }
+    }
+
+    const uint8_t *observation_bytes = reinterpret_cast<const uint8_t *>(m_observations.data());
+    m_checkpoint.records[OBSERVATIONS_RECORD].assign(observation_bytes,
+        observation_bytes + m_observations.size() * sizeof(FalconObservationValue));
+
+    m_checkpoint_writer.submit(m_checkpoint);
+}
+
+/*
+ * @brief  Swaps double-buffered component state once every wave has completed
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::publish_timestep_state(void)
+{
+    m_worker_pool.parallel_for(static_cast<uint32_t>(m_publish_components.size()), [this](uint32_t idx) {
+        m_publish_status[idx] = m_publish_components[idx]->publish_timestep_state();
+    });
+
+    for (size_t ii = 0; ii < m_publish_components.size(); ++ii)
+    {
+        if (m_publish_status[ii] != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Component " << m_publish_components[ii]->get_component_id() << " failed to publish timestep "
+                                     << m_current_timestep << ": " << m_publish_components[ii]->get_component_status_str(m_publish_status[ii]);
+            return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+        }
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Assigns every component to a rank
+ *
+ * Without a transport every component is local. Otherwise the dependency
+ *  graph is partitioned to minimize the number of dependency edges that cross
+ *  ranks, since each of them costs a state exchange every timestep.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::partition_components(void)
+{
+    m_component_ranks.clear();
+
+    if (m_transport == nullptr && m_arg_parser.get_num_ranks() > 1)
+    {
+        m_transport = std::make_shared<falcon_simulation_environment_tcp_transport>(
+            m_arg_parser.get_rank(), m_arg_parser.get_transport_hosts(), m_arg_parser.get_transport_base_port());
+    }
+
+    if (m_transport == nullptr)
+    {
+        for (auto &entry : m_components_by_id)
+        {
+            m_component_ranks[entry.first] = 0;
+        }
+
+        return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+    }
+
+    if (!m_transport->initialize())
+    {
+        return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+    }
+
+    m_rank = m_transport->get_rank();
+
+    falcon_simulation_environment_partitioner partitioner;
+    std::map<FalconChannelId, FalconComponentIdList> channel_endpoints;
+
+    for (auto &entry : m_components_by_id)
+    {
+        partitioner.add_component(entry.first);
+
+        for (auto dependency_id : entry.second->get_timestep_advance_dependency_ids())
+        {
+            partitioner.add_edge(entry.first, dependency_id, 1);
+        }
+
+        for (auto dependency_id : entry.second->get_previous_timestep_dependency_ids())
+        {
+            partitioner.add_edge(entry.first, dependency_id, 1);
+        }
+
+        for (auto channel_id : entry.second->get_input_channel_ids())
+        {
+            channel_endpoints[channel_id].push_back(entry.first);
+        }
+
+        for (auto channel_id : entry.second->get_output_channel_ids())
+        {
+            channel_endpoints[channel_id].push_back(entry.first);
+        }
+    }
+
+    for (auto &entry : channel_endpoints)
+    {
+        for (auto id : entry.second)
+        {
+            partitioner.add_edge(entry.second.front(), id, FALCON_MANAGER_CHANNEL_EDGE_WEIGHT);
+        }
+    }
+
+    partitioner.partition(m_transport->get_num_ranks(), m_component_ranks);
+
+    for (auto &entry : channel_endpoints)
+    {
+        for (auto id : entry.second)
+        {
+            if (m_component_ranks[id] != m_component_ranks[entry.second.front()])
+            {
+                BOOST_LOG_TRIVIAL(error) << "Channel " << entry.first << " endpoints could not be placed on a single rank";
+                return FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_COMPONENT_DEPENDENCY;
+            }
+        }
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Rank " << m_rank << " of " << m_transport->get_num_ranks()
+                            << " partitioned " << m_components_by_id.size() << " component(s) with cut weight "
+                            << partitioner.get_cut_weight(m_component_ranks);
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/*
+ * @brief  Records the dependency edges that cross between this rank and a peer
+ *
+ * @param  get_dependency_ids Component method that returns the dependency set.
+ * @param  component_waves    Wave index of every component.
+ * @param  per_wave           True to exchange state after the dependency's
+ *                             wave; false to exchange it after publication.
+ */
+void falcon_simulation_environment_manager::add_boundary_edges(FalconDependencyIdGetter get_dependency_ids, std::map<FalconComponentId, uint32_t> &component_waves, bool per_wave)
+{
+    for (auto &entry : m_components_by_id)
+    {
+        FalconRank dependent_rank = m_component_ranks[entry.first];
+
+        for (auto dependency_id : (entry.second.get()->*get_dependency_ids)())
+        {
+            FalconRank dependency_rank = m_component_ranks[dependency_id];
+            if (dependency_rank == dependent_rank)
+            {
+                continue;
+            }
+
+            boundary_exchange &exchange = per_wave ? m_wave_exchanges[component_waves[dependency_id]] : m_publish_exchange;
+            if (dependency_rank == m_rank)
+            {
+                exchange.outgoing[dependent_rank].insert(dependency_id);
+            }
+            else if (dependent_rank == m_rank)
+            {
+                exchange.incoming[dependency_rank].insert(dependency_id);
+            }
+        }
+    }
+}
+
+/*
+ * @brief  Sends local boundary component state to peers and refreshes the
+ *          local proxies of remote boundary components
+ *
+ * Each message holds the length-prefixed state of its components in ascending
+ *  component identifier order, which both ranks derive independently.
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_manager::exchange_boundary_state(boundary_exchange &exchange)
+{
+    if (exchange.outgoing.empty() && exchange.incoming.empty())
+    {
+        return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+    }
+
+    FalconRankBufferMap outgoing;
+    FalconRankBufferMap incoming;
+    FalconStateBuffer state;
+
+    for (auto &entry : exchange.outgoing)
+    {
+        FalconTransportBuffer &message = outgoing[entry.first];
+        for (auto id : entry.second)
+        {
+            FALCON_COMPONENT_STATUS_ENUM component_ret = m_components_by_id[id]->serialize_state(state);
+            if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to serialize state: "
+                                         << m_components_by_id[id]->get_component_status_str(component_ret);
+                return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+            }
+
+            uint32_t state_size = htonl(static_cast<uint32_t>(state.size()));
+            const uint8_t *size_bytes = reinterpret_cast<const uint8_t *>(&state_size);
+            message.insert(message.end(), size_bytes, size_bytes + sizeof(state_size));
+            message.insert(message.end(), state.begin(), state.end());
+        }
+    }
+
+    for (auto &entry : exchange.incoming)
+    {
+        incoming[entry.first] = FalconTransportBuffer();
+    }
+
+    if (!m_transport->exchange(outgoing, incoming))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " failed to exchange boundary state for timestep " << m_current_timestep;
+        return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+    }
+
+    for (auto &entry : exchange.incoming)
+    {
+        const FalconTransportBuffer &message = incoming[entry.first];
+        size_t offset = 0;
+
+        for (auto id : entry.second)
+        {
+            uint32_t state_size = 0;
+            if (offset + sizeof(state_size) > message.size())
+            {
+                return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+            }
+
+            memcpy(&state_size, message.data() + offset, sizeof(state_size));
+            state_size = ntohl(state_size);
+            offset += sizeof(state_size);
+
+            if (offset + state_size > message.size())
+            {
+                return FALCON_MANAGER_STATUS_ENUM::TRANSPORT_FAILURE;
+            }
+
+            state.assign(message.begin() + offset, message.begin() + offset + state_size);
+            offset += state_size;
+
+            FALCON_COMPONENT_STATUS_ENUM component_ret = m_components_by_id[id]->deserialize_state(state);
+            if (component_ret != FALCON_COMPONENT_STATUS_ENUM::SUCCESS)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Component " << id << " failed to deserialize state: "
+                                         << m_components_by_id[id]->get_component_status_str(component_ret);
+                return FALCON_MANAGER_STATUS_ENUM::COMPONENT_FAILURE;
+            }
+        }
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
@@ -0,0 +1,238 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_metrics.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment metrics registry.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the metrics registry. Value blocks are allocated the first time a
+ *  thread updates a registry and are kept until the registry is destroyed, so
+ *  updates made by threads that have since exited are still counted.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Log registrations past capacity.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cmath>
+#include <list>
+#include <map>
+#include <sstream>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_metrics.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+/* must be kept in sync with FALCON_METRIC_TYPE_ENUM */
+const char * falcon_simulation_environment_metrics::metric_type_names[static_cast<uint32_t>(FALCON_METRIC_TYPE_ENUM::NUMBER_OF_TYPES)] =
+{
+    "counter",
+    "gauge"
+};
+
+/* serial zero is never assigned, so a fresh thread cache never matches */
+std::atomic<uint64_t> falcon_simulation_environment_metrics::next_registry_serial(1);
+thread_local falcon_simulation_environment_metrics::thread_cache falcon_simulation_environment_metrics::current_thread_cache = { 0, nullptr };
+
+falcon_simulation_environment_metrics::falcon_simulation_environment_metrics(uint32_t capacity)
+  : m_serial(next_registry_serial.fetch_add(1)),
+    m_capacity(capacity),
+    m_set_values(new std::atomic<double>[capacity]())
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_metrics::~falcon_simulation_environment_metrics(void)
+{
+    /* no action required at this time */
+}
+
+FalconMetricId falcon_simulation_environment_metrics::register_counter(const std::string &name, const std::string &labels,
+                                                                       const std::string &help)
+{
+    return register_metric(name, labels, help, FALCON_METRIC_TYPE_ENUM::COUNTER, nullptr);
+}
+
+FalconMetricId falcon_simulation_environment_metrics::register_gauge(const std::string &name, const std::string &labels,
+                                                                     const std::string &help)
+{
+    return register_metric(name, labels, help, FALCON_METRIC_TYPE_ENUM::GAUGE, nullptr);
+}
+
+FalconMetricId falcon_simulation_environment_metrics::register_sampled_gauge(const std::string &name, const std::string &labels,
+                                                                             const std::string &help, FalconMetricSampler sampler)
+{
+    return register_metric(name, labels, help, FALCON_METRIC_TYPE_ENUM::GAUGE, sampler);
+}
+
+/*
+ * @brief  Merges the value of a metric across every thread
+ */
+double falcon_simulation_environment_metrics::read(FalconMetricId id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return read_locked(id);
+}
+
+/*
+ * @brief  Renders every metric in the Prometheus text exposition format
+ *
+ * Metrics sharing a name are emitted together under a single HELP and TYPE
+ *  line, in the order their names were first registered.
+ */
+std::string falcon_simulation_environment_metrics::render_prometheus(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::list<std::string> family_names;
+    std::map<std::string, std::vector<FalconMetricId>> families;
+    for (FalconMetricId id = 0; id < m_metrics.size(); ++id)
+    {
+        if (families.count(m_metrics[id].name) == 0)
+        {
+            family_names.push_back(m_metrics[id].name);
+        }
+        families[m_metrics[id].name].push_back(id);
+    }
+
+    std::stringstream ss;
+    ss.precision(15);
+    for (auto &name : family_names)
+    {
+        const metric_descriptor &first = m_metrics[families[name].front()];
+        ss << "# HELP " << name << " " << first.help << "\n";
+        ss << "# TYPE " << name << " " << metric_type_names[static_cast<uint32_t>(first.type)] << "\n";
+
+        for (auto id : families[name])
+        {
+            ss << name;
+            if (!m_metrics[id].labels.empty())
+            {
+                ss << "{" << m_metrics[id].labels << "}";
+            }
+
+            double value = read_locked(id);
+            if (std::isfinite(value))
+            {
+                ss << " " << value << "\n";
+            }
+            else
+            {
+                ss << " NaN\n";
+            }
+        }
+    }
+
+    return ss.str();
+}
+
+FalconMetricId falcon_simulation_environment_metrics::register_metric(const std::string &name, const std::string &labels,
+                                                                      const std::string &help, FALCON_METRIC_TYPE_ENUM type,
+                                                                      FalconMetricSampler sampler)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_metrics.size() >= m_capacity)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Metrics registry is full (" << m_capacity << " metrics); "
+                                 << name << "{" << labels << "} will not be reported";
+        return FALCON_METRICS_INVALID_ID;
+    }
+
+    m_metrics.push_back({ name, labels, help, type, sampler });
+
+    return static_cast<FalconMetricId>(m_metrics.size() - 1);
+}
+
+/*
+ * @brief  Finds or allocates the value block of the calling thread
+ *
+ * Only taken on a thread's first update, or when a thread alternates between
+ *  registries.
+ */
+std::atomic<int64_t> * falcon_simulation_environment_metrics::create_thread_values(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::unique_ptr<std::atomic<int64_t>[]> &values = m_thread_values[std::this_thread::get_id()];
+    if (values == nullptr)
+    {
+        values.reset(new std::atomic<int64_t>[m_capacity]());
+    }
+
+    current_thread_cache.registry_serial = m_serial;
+    current_thread_cache.values = values.get();
+
+    return values.get();
+}
+
+double falcon_simulation_environment_metrics::read_locked(FalconMetricId id)
+{
+    if (id >= m_metrics.size())
+    {
+        return NAN;
+    }
+
+    if (m_metrics[id].sampler != nullptr)
+    {
+        return m_metrics[id].sampler();
+    }
+
+    int64_t sum = 0;
+    for (auto &entry : m_thread_values)
+    {
+        sum += entry.second[id].load(std::memory_order_relaxed);
+    }
+
+    return m_set_values[id].load(std::memory_order_relaxed) + static_cast<double>(sum);
+}
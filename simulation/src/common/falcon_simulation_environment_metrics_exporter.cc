@@ -0,0 +1,333 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_metrics_exporter.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment metrics exporter.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the metrics exporter. A minimal HTTP/1.0 responder answers one
+ *  request per connection; requests are served one at a time, which is ample
+ *  for a scraper polling every few seconds. A pipe wakes the exporter thread
+ *  from poll() at shutdown.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_metrics_exporter.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const int LISTEN_BACKLOG = 8;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static void send_response(int fd, const char *status, const std::string &body)
+{
+    std::stringstream ss;
+    ss << "HTTP/1.0 " << status << "\r\n"
+       << "Content-Type: text/plain; version=0.0.4\r\n"
+       << "Content-Length: " << body.size() << "\r\n"
+       << "Connection: close\r\n\r\n"
+       << body;
+
+    std::string response = ss.str();
+    const char *ptr = response.data();
+    size_t len = response.size();
+    while (len > 0)
+    {
+        ssize_t ret = send(fd, ptr, len, MSG_NOSIGNAL);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            return;
+        }
+
+        ptr += ret;
+        len -= ret;
+    }
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_metrics_exporter::falcon_simulation_environment_metrics_exporter(void)
+  : m_summary_interval_secs(0),
+    m_listen_fd(-1),
+    m_wake_fds{ -1, -1 }
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_metrics_exporter::~falcon_simulation_environment_metrics_exporter(void)
+{
+    shutdown();
+}
+
+/*
+ * @brief  Opens the endpoint, if requested, and starts the exporter thread
+ *
+ * @return True on success, or if both the endpoint and the summary are
+ *          disabled; false if the socket could not be opened.
+ */
+bool falcon_simulation_environment_metrics_exporter::initialize(std::shared_ptr<falcon_simulation_environment_metrics> metrics,
+                                                                const std::string &socket_path,
+                                                                uint32_t summary_interval_secs,
+                                                                FalconMetricsSummary summary)
+{
+    if (m_thread.joinable())
+    {
+        return false;
+    }
+
+    m_metrics = metrics;
+    m_socket_path = socket_path;
+    m_summary_interval_secs = summary_interval_secs;
+    m_summary = summary;
+
+    if (m_socket_path.empty() && m_summary_interval_secs == 0)
+    {
+        return true;
+    }
+
+    if (!m_socket_path.empty())
+    {
+        m_listen_fd = listen_on_socket();
+        if (m_listen_fd < 0)
+        {
+            return false;
+        }
+
+        BOOST_LOG_TRIVIAL(info) << "Serving metrics on unix socket " << m_socket_path;
+    }
+
+    if (pipe(m_wake_fds) != 0)
+    {
+        shutdown();
+        return false;
+    }
+
+    m_thread = std::thread(&falcon_simulation_environment_metrics_exporter::exporter_thread_main, this);
+
+    return true;
+}
+
+/*
+ * @brief  Stops the exporter thread and removes the socket
+ */
+void falcon_simulation_environment_metrics_exporter::shutdown(void)
+{
+    if (m_thread.joinable())
+    {
+        char wake = 0;
+        while (write(m_wake_fds[1], &wake, sizeof(wake)) < 0 && errno == EINTR)
+        {
+            /* retry until the exporter thread has been woken */
+        }
+
+        m_thread.join();
+    }
+
+    for (auto &fd : m_wake_fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    if (m_listen_fd >= 0)
+    {
+        close(m_listen_fd);
+        m_listen_fd = -1;
+        unlink(m_socket_path.c_str());
+    }
+}
+
+int falcon_simulation_environment_metrics_exporter::listen_on_socket(void)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (m_socket_path.size() >= sizeof(addr.sun_path))
+    {
+        BOOST_LOG_TRIVIAL(error) << "Metrics socket path " << m_socket_path << " is too long";
+        return -1;
+    }
+    strncpy(addr.sun_path, m_socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    /* a socket left behind by an earlier run would make bind() fail */
+    unlink(m_socket_path.c_str());
+
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+        listen(fd, LISTEN_BACKLOG) != 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to listen on metrics socket " << m_socket_path << ": " << strerror(errno);
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+void falcon_simulation_environment_metrics_exporter::exporter_thread_main(void)
+{
+    const std::chrono::seconds summary_interval(m_summary_interval_secs);
+    auto next_summary = std::chrono::steady_clock::now() + summary_interval;
+
+    while (true)
+    {
+        int timeout_ms = -1;
+        if (m_summary_interval_secs > 0)
+        {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(next_summary - std::chrono::steady_clock::now());
+            timeout_ms = static_cast<int>(std::max<int64_t>(remaining.count(), 0));
+        }
+
+        struct pollfd pfds[2] = { { m_wake_fds[0], POLLIN, 0 }, { m_listen_fd, POLLIN, 0 } };
+        int ret = poll(pfds, (m_listen_fd >= 0) ? 2 : 1, timeout_ms);
+        if (ret < 0 && errno != EINTR)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Metrics exporter stopped: " << strerror(errno);
+            break;
+        }
+
+        if (ret > 0 && pfds[0].revents != 0)
+        {
+            break;
+        }
+
+        if (ret > 0 && pfds[1].revents != 0)
+        {
+            int fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd >= 0)
+            {
+                serve_connection(fd);
+                close(fd);
+            }
+        }
+
+        if (m_summary_interval_secs > 0 && std::chrono::steady_clock::now() >= next_summary)
+        {
+            BOOST_LOG_TRIVIAL(info) << m_summary();
+            next_summary += summary_interval;
+        }
+    }
+}
+
+/*
+ * @brief  Reads a single HTTP request and answers it
+ *
+ * Only the request line is inspected; GET /metrics is answered with the
+ *  registry and anything else with 404.
+ */
+void falcon_simulation_environment_metrics_exporter::serve_connection(int fd)
+{
+    std::string request;
+    char buffer[1024];
+
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < FALCON_METRICS_EXPORTER_MAX_REQUEST_SIZE)
+    {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, FALCON_METRICS_EXPORTER_REQUEST_TIMEOUT_MS) <= 0)
+        {
+            return;
+        }
+
+        ssize_t num_read = recv(fd, buffer, sizeof(buffer), 0);
+        if (num_read < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (num_read <= 0)
+        {
+            break;
+        }
+
+        request.append(buffer, num_read);
+    }
+
+    std::string method;
+    std::string target;
+    std::stringstream request_line(request.substr(0, request.find("\r\n")));
+    request_line >> method >> target;
+
+    if (method == "GET" && (target == "/metrics" || target == "/"))
+    {
+        send_response(fd, "200 OK", m_metrics->render_prometheus());
+    }
+    else
+    {
+        send_response(fd, "404 Not Found", "not found\n");
+    }
+}
@@ -0,0 +1,285 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_partitioner.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment component graph partitioner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a two phase graph partitioner. Partitions are first grown from
+ *  seed components by breadth-first search, which keeps connected components
+ *  together, and then refined by greedily moving components to the partition
+ *  holding most of their edge weight while respecting the balance limit. The
+ *  objective is to minimize the weight of edges cut between ranks, since every
+ *  cut edge costs a state exchange each timestep.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added component weights.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <vector>
+
+#include "common/falcon_simulation_environment_partitioner.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_partitioner::falcon_simulation_environment_partitioner(void)
+  : m_total_weight(0)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_partitioner::~falcon_simulation_environment_partitioner(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Adds a component; adding it again replaces its weight
+ */
+void falcon_simulation_environment_partitioner::add_component(FalconComponentId id, uint64_t weight)
+{
+    m_adjacency[id];
+
+    m_total_weight -= m_weights[id];
+    m_weights[id] = weight;
+    m_total_weight += weight;
+}
+
+/*
+ * @brief  Adds weight to the undirected edge between two components
+ */
+void falcon_simulation_environment_partitioner::add_edge(FalconComponentId a, FalconComponentId b, uint32_t weight)
+{
+    if (a != b)
+    {
+        if (m_weights.find(a) == m_weights.end())
+        {
+            add_component(a);
+        }
+
+        if (m_weights.find(b) == m_weights.end())
+        {
+            add_component(b);
+        }
+
+        m_adjacency[a][b] += weight;
+        m_adjacency[b][a] += weight;
+    }
+}
+
+/*
+ * @brief  Assigns every component to one of num_parts partitions
+ *
+ * @return True on success; false if num_parts is zero.
+ */
+bool falcon_simulation_environment_partitioner::partition(uint32_t num_parts, FalconComponentRankMap &parts)
+{
+    parts.clear();
+
+    if (num_parts == 0)
+    {
+        return false;
+    }
+
+    grow_initial_partition(num_parts, parts);
+
+    for (uint32_t ii = 0; ii < FALCON_PARTITIONER_MAX_REFINEMENT_PASSES; ++ii)
+    {
+        if (refine_partition(num_parts, parts) == 0)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+uint64_t falcon_simulation_environment_partitioner::get_cut_weight(const FalconComponentRankMap &parts)
+{
+    uint64_t ret = 0;
+    for (auto &node : m_adjacency)
+    {
+        for (auto &edge : node.second)
+        {
+            /* count each undirected edge once */
+            if (node.first < edge.first && parts.at(node.first) != parts.at(edge.first))
+            {
+                ret += edge.second;
+            }
+        }
+    }
+
+    return ret;
+}
+
+uint64_t falcon_simulation_environment_partitioner::get_part_weight(const FalconComponentRankMap &parts, FalconRank part)
+{
+    uint64_t ret = 0;
+    for (auto &entry : parts)
+    {
+        if (entry.second == part)
+        {
+            ret += m_weights[entry.first];
+        }
+    }
+
+    return ret;
+}
+
+void falcon_simulation_environment_partitioner::grow_initial_partition(uint32_t num_parts, FalconComponentRankMap &parts)
+{
+    const size_t num_components = m_adjacency.size();
+    auto next_seed = m_adjacency.begin();
+    uint64_t remaining_weight = m_total_weight;
+
+    for (FalconRank part = 0; part < num_parts && parts.size() < num_components; ++part)
+    {
+        /* an even share of what is left, rounded up so that any remainder is
+         *  spread over the lowest partitions */
+        const uint32_t remaining_parts = num_parts - part;
+        uint64_t target_weight = (remaining_weight + remaining_parts - 1) / remaining_parts;
+        uint64_t part_weight = 0;
+
+        std::list<FalconComponentId> frontier;
+        while (part_weight < target_weight && parts.size() < num_components)
+        {
+            if (frontier.empty())
+            {
+                while (parts.find(next_seed->first) != parts.end())
+                {
+                    ++next_seed;
+                }
+
+                frontier.push_back(next_seed->first);
+            }
+
+            FalconComponentId id = frontier.front();
+            frontier.pop_front();
+
+            if (parts.find(id) != parts.end())
+            {
+                continue;
+            }
+
+            parts[id] = part;
+            part_weight += m_weights[id];
+
+            for (auto &edge : m_adjacency[id])
+            {
+                if (parts.find(edge.first) == parts.end())
+                {
+                    frontier.push_back(edge.first);
+                }
+            }
+        }
+
+        remaining_weight -= std::min(part_weight, remaining_weight);
+    }
+}
+
+/*
+ * @brief  Single greedy refinement pass
+ *
+ * @return Number of components that moved.
+ */
+uint32_t falcon_simulation_environment_partitioner::refine_partition(uint32_t num_parts, FalconComponentRankMap &parts)
+{
+    const uint64_t max_part_weight = static_cast<uint64_t>(
+        std::ceil(m_total_weight * (1.0 + FALCON_PARTITIONER_MAX_IMBALANCE) / num_parts));
+
+    std::vector<size_t> part_sizes(num_parts, 0);
+    std::vector<uint64_t> part_total_weights(num_parts, 0);
+    for (auto &entry : parts)
+    {
+        part_sizes[entry.second]++;
+        part_total_weights[entry.second] += m_weights[entry.first];
+    }
+
+    uint32_t num_moves = 0;
+    std::vector<uint64_t> part_weights(num_parts);
+
+    for (auto &node : m_adjacency)
+    {
+        FalconRank current_part = parts[node.first];
+        const uint64_t weight = m_weights[node.first];
+
+        std::fill(part_weights.begin(), part_weights.end(), 0);
+        for (auto &edge : node.second)
+        {
+            part_weights[parts[edge.first]] += edge.second;
+        }
+
+        FalconRank best_part = current_part;
+        for (FalconRank part = 0; part < num_parts; ++part)
+        {
+            if (part_weights[part] > part_weights[best_part] && part_total_weights[part] + weight <= max_part_weight)
+            {
+                best_part = part;
+            }
+        }
+
+        if (best_part != current_part && part_sizes[current_part] > 1)
+        {
+            parts[node.first] = best_part;
+            part_sizes[current_part]--;
+            part_sizes[best_part]++;
+            part_total_weights[current_part] -= weight;
+            part_total_weights[best_part] += weight;
+            num_moves++;
+        }
+    }
+
+    return num_moves;
+}
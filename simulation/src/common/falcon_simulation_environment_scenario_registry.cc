@@ -0,0 +1,136 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_scenario_registry.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment scenario registry.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the process-wide registry of named scenarios. The built-in
+ *  "empty" scenario has no components and is used to measure the fixed
+ *  per-timestep overhead of the manager and its bindings.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_scenario_registry & falcon_simulation_environment_scenario_registry::get_instance(void)
+{
+    /* constructed on first use so that registration from other translation
+     *  units does not depend on static initialization order */
+    static falcon_simulation_environment_scenario_registry instance;
+    return instance;
+}
+
+falcon_simulation_environment_scenario_registry::falcon_simulation_environment_scenario_registry(void)
+{
+    m_factories["empty"] = [](falcon_simulation_environment_manager &) {
+        return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+    };
+}
+
+falcon_simulation_environment_scenario_registry::~falcon_simulation_environment_scenario_registry(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Adds a named scenario
+ *
+ * @return True if the scenario was added; false if the name is already taken.
+ */
+bool falcon_simulation_environment_scenario_registry::register_scenario(const std::string &name, FalconScenarioFactory factory)
+{
+    if (m_factories.find(name) != m_factories.end())
+    {
+        return false;
+    }
+
+    m_factories[name] = factory;
+    return true;
+}
+
+bool falcon_simulation_environment_scenario_registry::has_scenario(const std::string &name)
+{
+    return m_factories.find(name) != m_factories.end();
+}
+
+std::list<std::string> falcon_simulation_environment_scenario_registry::get_scenario_names(void)
+{
+    std::list<std::string> ret;
+    for (auto &entry : m_factories)
+    {
+        ret.push_back(entry.first);
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Adds the components of a named scenario to a manager that has not
+ *          yet been initialized
+ */
+FALCON_MANAGER_STATUS_ENUM falcon_simulation_environment_scenario_registry::add_scenario_components(const std::string &name, falcon_simulation_environment_manager &manager)
+{
+    auto iter = m_factories.find(name);
+    if (iter == m_factories.end())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unknown scenario '" << name << "'";
+        return FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    return iter->second(manager);
+}
@@ -0,0 +1,390 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_sweep_spec.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment parameter sweep specification.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements parsing and expansion of parameter sweep specification files.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Seed ranges are counted and bounded.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+
+#include "common/falcon_simulation_environment_sweep_spec.h"
+#include "falcon_log.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static std::string trim(const std::string &str)
+{
+    size_t first = str.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+    {
+        return std::string();
+    }
+
+    size_t last = str.find_last_not_of(" \t\r\n");
+    return str.substr(first, last - first + 1);
+}
+
+static std::vector<std::string> split_values(const std::string &str)
+{
+    std::vector<std::string> ret;
+    std::stringstream ss(str);
+    std::string value;
+
+    while (std::getline(ss, value, ','))
+    {
+        value = trim(value);
+        if (!value.empty())
+        {
+            ret.push_back(value);
+        }
+    }
+
+    return ret;
+}
+
+static bool parse_unsigned(const std::string &str, uint64_t &value)
+{
+    char *end = nullptr;
+
+    if (str.empty() || str[0] == '-')
+    {
+        return false;
+    }
+
+    value = strtoull(str.c_str(), &end, 10);
+    return end != nullptr && *end == '\0';
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_sweep_spec::falcon_simulation_environment_sweep_spec(void)
+  : m_duration_in_secs(0)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_sweep_spec::~falcon_simulation_environment_sweep_spec(void)
+{
+    /* no action required at this time */
+}
+
+bool falcon_simulation_environment_sweep_spec::load(const std::string &path)
+{
+    std::ifstream input(path);
+    if (!input.is_open())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to open sweep specification " << path;
+        return false;
+    }
+
+    return parse(input);
+}
+
+/*
+ * @brief  Parses a sweep specification and expands it into trials
+ *
+ * @return True on success; false if the specification is malformed or does
+ *          not name a scenario and duration.
+ */
+bool falcon_simulation_environment_sweep_spec::parse(std::istream &input)
+{
+    m_scenario_names.clear();
+    m_duration_in_secs = 0;
+    m_seeds.clear();
+    m_parameters.clear();
+    m_trials.clear();
+
+    std::string line;
+    uint32_t line_number = 0;
+    while (std::getline(input, line))
+    {
+        line_number++;
+        if (!parse_line(line.substr(0, line.find('#')), line_number))
+        {
+            return false;
+        }
+    }
+
+    if (m_scenario_names.empty() || m_duration_in_secs == 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep specification must provide a scenario and a non-zero duration";
+        return false;
+    }
+
+    if (m_seeds.empty())
+    {
+        m_seeds.push_back(0);
+    }
+
+    uint64_t num_trials = m_scenario_names.size() * m_seeds.size();
+    for (auto &parameter : m_parameters)
+    {
+        if (num_trials > FALCON_SWEEP_MAX_TRIALS)
+        {
+            break;
+        }
+        num_trials *= parameter.second.size();
+    }
+
+    if (num_trials > FALCON_SWEEP_MAX_TRIALS)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep specification expands to more than " << FALCON_SWEEP_MAX_TRIALS << " trials";
+        return false;
+    }
+
+    expand_trials();
+
+    return true;
+}
+
+const FalconSweepTrialList & falcon_simulation_environment_sweep_spec::get_trials(void) const
+{
+    return m_trials;
+}
+
+/*
+ * @brief  Computes a 64-bit FNV-1a hash over the expanded trial list
+ */
+uint64_t falcon_simulation_environment_sweep_spec::get_fingerprint(void) const
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    for (auto &trial : m_trials)
+    {
+        std::stringstream ss;
+        ss << trial.trial_id << '\t' << trial.scenario_name << '\t' << trial.seed << '\t'
+           << trial.duration_in_secs << '\t' << format_parameters(trial.parameters) << '\n';
+
+        for (char c : ss.str())
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+    }
+
+    return hash;
+}
+
+/*
+ * @brief  Formats trial parameters as "key=value;key=value", or "-" if the
+ *          trial has no parameters
+ */
+std::string falcon_simulation_environment_sweep_spec::format_parameters(const FalconTrialParameters &parameters)
+{
+    if (parameters.empty())
+    {
+        return "-";
+    }
+
+    std::stringstream ss;
+    for (auto iter = parameters.begin(); iter != parameters.end(); ++iter)
+    {
+        ss << (iter == parameters.begin() ? "" : ";") << iter->first << "=" << iter->second;
+    }
+
+    return ss.str();
+}
+
+bool falcon_simulation_environment_sweep_spec::parse_line(const std::string &line, uint32_t line_number)
+{
+    std::string content = trim(line);
+    if (content.empty())
+    {
+        return true;
+    }
+
+    size_t separator = content.find('=');
+    if (separator == std::string::npos)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep specification line " << line_number << ": expected 'key = value'";
+        return false;
+    }
+
+    std::string key = trim(content.substr(0, separator));
+    std::vector<std::string> values = split_values(content.substr(separator + 1));
+    if (key.empty() || values.empty())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep specification line " << line_number << ": missing key or value";
+        return false;
+    }
+
+    bool ret = false;
+    if (key == "scenario")
+    {
+        m_scenario_names.insert(m_scenario_names.end(), values.begin(), values.end());
+        ret = true;
+    }
+    else if (key == "duration")
+    {
+        ret = values.size() == 1 && parse_unsigned(values[0], m_duration_in_secs);
+    }
+    else if (key == "seeds")
+    {
+        ret = parse_seeds(values);
+    }
+    else if (key.compare(0, strlen(FALCON_SWEEP_PARAMETER_PREFIX), FALCON_SWEEP_PARAMETER_PREFIX) == 0 &&
+             key.size() > strlen(FALCON_SWEEP_PARAMETER_PREFIX))
+    {
+        m_parameters.push_back(std::make_pair(key.substr(strlen(FALCON_SWEEP_PARAMETER_PREFIX)), values));
+        ret = true;
+    }
+
+    if (!ret)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep specification line " << line_number << ": invalid entry '" << key << "'";
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Parses seeds given either individually or as inclusive "first-last"
+ *          ranges
+ */
+bool falcon_simulation_environment_sweep_spec::parse_seeds(const std::vector<std::string> &values)
+{
+    for (auto &value : values)
+    {
+        uint64_t first = 0;
+        uint64_t last = 0;
+
+        size_t separator = value.find('-');
+        if (separator == std::string::npos)
+        {
+            if (!parse_unsigned(value, first))
+            {
+                return false;
+            }
+            last = first;
+        }
+        else if (!parse_unsigned(trim(value.substr(0, separator)), first) ||
+                 !parse_unsigned(trim(value.substr(separator + 1)), last) ||
+                 last < first)
+        {
+            return false;
+        }
+
+        /* counted rather than compared against last, which may be UINT64_MAX */
+        uint64_t num_seeds_minus_one = last - first;
+        if (num_seeds_minus_one >= FALCON_SWEEP_MAX_TRIALS - m_seeds.size())
+        {
+            BOOST_LOG_TRIVIAL(error) << "Seed range " << value << " exceeds " << FALCON_SWEEP_MAX_TRIALS << " seeds in total";
+            return false;
+        }
+
+        for (uint64_t ii = 0; ii <= num_seeds_minus_one; ++ii)
+        {
+            m_seeds.push_back(first + ii);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * @brief  Expands the specification into the cartesian product of scenarios,
+ *          parameter values and seeds
+ */
+void falcon_simulation_environment_sweep_spec::expand_trials(void)
+{
+    std::vector<size_t> value_indices(m_parameters.size(), 0);
+
+    for (auto &scenario_name : m_scenario_names)
+    {
+        bool combinations_remaining = true;
+        while (combinations_remaining)
+        {
+            FalconTrialParameters parameters;
+            for (size_t ii = 0; ii < m_parameters.size(); ++ii)
+            {
+                parameters[m_parameters[ii].first] = m_parameters[ii].second[value_indices[ii]];
+            }
+
+            for (auto seed : m_seeds)
+            {
+                falcon_simulation_environment_sweep_trial trial;
+                trial.trial_id = static_cast<FalconTrialId>(m_trials.size());
+                trial.scenario_name = scenario_name;
+                trial.seed = seed;
+                trial.duration_in_secs = m_duration_in_secs;
+                trial.parameters = parameters;
+                m_trials.push_back(trial);
+            }
+
+            /* advance the parameter value indices like an odometer */
+            combinations_remaining = false;
+            for (size_t ii = m_parameters.size(); ii-- > 0; )
+            {
+                if (++value_indices[ii] < m_parameters[ii].second.size())
+                {
+                    combinations_remaining = true;
+                    break;
+                }
+                value_indices[ii] = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,552 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_tcp_transport.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment TCP transport.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a transport that connects every pair of ranks with a TCP socket.
+ *  Lower ranks accept connections from higher ranks, which identify themselves
+ *  with a short hello message. The hello message and the 32-bit length that
+ *  frames every message are in network byte order; payloads are passed
+ *  through unchanged.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Frame headers in network byte order.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <map>
+#include <thread>
+
+#include "falcon_log.h"
+
+#include "common/falcon_simulation_environment_tcp_transport.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t CONNECT_RETRY_INTERVAL_MS = 50;
+static const size_t FRAME_HEADER_SIZE = sizeof(uint32_t);
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/* progress of a single exchange() with one peer */
+struct peer_exchange_state
+{
+    int                        fd;
+
+    const FalconTransportBuffer *  out;
+    uint32_t                   out_header;
+    size_t                     out_offset;
+
+    FalconTransportBuffer *        in;
+    uint32_t                   in_header;
+    uint32_t                   in_size;
+    size_t                     in_offset;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static bool write_fully(int fd, const void *data, size_t len)
+{
+    const uint8_t *ptr = static_cast<const uint8_t *>(data);
+    while (len > 0)
+    {
+        ssize_t ret = send(fd, ptr, len, MSG_NOSIGNAL);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            return false;
+        }
+
+        ptr += ret;
+        len -= ret;
+    }
+
+    return true;
+}
+
+static bool read_fully(int fd, void *data, size_t len)
+{
+    uint8_t *ptr = static_cast<uint8_t *>(data);
+    while (len > 0)
+    {
+        ssize_t ret = recv(fd, ptr, len, 0);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (ret <= 0)
+        {
+            return false;
+        }
+
+        ptr += ret;
+        len -= ret;
+    }
+
+    return true;
+}
+
+/* returns true once the complete frame has been sent */
+static bool progress_send(peer_exchange_state &state, bool &failed)
+{
+    const size_t frame_size = FRAME_HEADER_SIZE + state.out->size();
+
+    while (state.out_offset < frame_size)
+    {
+        const uint8_t *ptr;
+        size_t len;
+        if (state.out_offset < FRAME_HEADER_SIZE)
+        {
+            ptr = reinterpret_cast<const uint8_t *>(&state.out_header) + state.out_offset;
+            len = FRAME_HEADER_SIZE - state.out_offset;
+        }
+        else
+        {
+            ptr = state.out->data() + (state.out_offset - FRAME_HEADER_SIZE);
+            len = frame_size - state.out_offset;
+        }
+
+        ssize_t ret = send(state.fd, ptr, len, MSG_NOSIGNAL);
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        {
+            return false;
+        }
+        else if (ret <= 0)
+        {
+            failed = true;
+            return false;
+        }
+
+        state.out_offset += ret;
+    }
+
+    return true;
+}
+
+/* returns true once the complete frame has been received */
+static bool progress_recv(peer_exchange_state &state, bool &failed)
+{
+    while (true)
+    {
+        uint8_t *ptr;
+        size_t len;
+        if (state.in_offset < FRAME_HEADER_SIZE)
+        {
+            ptr = reinterpret_cast<uint8_t *>(&state.in_header) + state.in_offset;
+            len = FRAME_HEADER_SIZE - state.in_offset;
+        }
+        else
+        {
+            if (state.in_offset == FRAME_HEADER_SIZE)
+            {
+                state.in_size = ntohl(state.in_header);
+                state.in->resize(state.in_size);
+            }
+
+            if (state.in_offset - FRAME_HEADER_SIZE == state.in_size)
+            {
+                return true;
+            }
+
+            ptr = state.in->data() + (state.in_offset - FRAME_HEADER_SIZE);
+            len = state.in_size - (state.in_offset - FRAME_HEADER_SIZE);
+        }
+
+        ssize_t ret = recv(state.fd, ptr, len, 0);
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        {
+            return false;
+        }
+        else if (ret <= 0)
+        {
+            /* the peer closed the connection, most likely because it failed */
+            failed = true;
+            return false;
+        }
+
+        state.in_offset += ret;
+    }
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_tcp_transport::falcon_simulation_environment_tcp_transport(FalconRank rank, const std::vector<std::string> &hosts, uint16_t base_port)
+  : m_rank(rank),
+    m_hosts(hosts),
+    m_base_port(base_port)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_tcp_transport::~falcon_simulation_environment_tcp_transport(void)
+{
+    shutdown();
+}
+
+/*
+ * @brief  Establishes a connection to every other rank
+ *
+ * @return True if every peer connected before the connection timeout.
+ */
+bool falcon_simulation_environment_tcp_transport::initialize(void)
+{
+    if (m_rank >= m_hosts.size())
+    {
+        BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " is not less than the number of ranks " << m_hosts.size();
+        return false;
+    }
+
+    m_peer_fds.assign(m_hosts.size(), -1);
+
+    int listen_fd = -1;
+    if (m_rank + 1 < m_hosts.size())
+    {
+        listen_fd = listen_for_peers();
+        if (listen_fd < 0)
+        {
+            return false;
+        }
+    }
+
+    bool ret = true;
+
+    for (FalconRank peer = 0; peer < m_rank && ret; ++peer)
+    {
+        const uint32_t hello = htonl(m_rank);
+        m_peer_fds[peer] = connect_to_peer(peer);
+        ret = (m_peer_fds[peer] >= 0) && write_fully(m_peer_fds[peer], &hello, sizeof(hello));
+    }
+
+    for (uint32_t num_accepted = 0; num_accepted + m_rank + 1 < m_hosts.size() && ret; ++num_accepted)
+    {
+        struct pollfd pfd;
+        pfd.fd = listen_fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        if (poll(&pfd, 1, FALCON_TCP_TRANSPORT_CONNECT_TIMEOUT_MS) <= 0)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " timed out waiting for peer connections";
+            ret = false;
+            break;
+        }
+
+        int fd = accept(listen_fd, nullptr, nullptr);
+        uint32_t hello = 0;
+        bool have_hello = (fd >= 0) && read_fully(fd, &hello, sizeof(hello));
+        FalconRank peer = ntohl(hello);
+        if (!have_hello || peer <= m_rank || peer >= m_hosts.size() || m_peer_fds[peer] >= 0)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " received an invalid peer connection";
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+
+            ret = false;
+            break;
+        }
+
+        m_peer_fds[peer] = fd;
+    }
+
+    if (listen_fd >= 0)
+    {
+        close(listen_fd);
+    }
+
+    for (auto fd : m_peer_fds)
+    {
+        if (ret && fd >= 0)
+        {
+            ret = configure_peer_socket(fd);
+        }
+    }
+
+    if (!ret)
+    {
+        shutdown();
+    }
+
+    return ret;
+}
+
+void falcon_simulation_environment_tcp_transport::shutdown(void)
+{
+    for (auto &fd : m_peer_fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+}
+
+FalconRank falcon_simulation_environment_tcp_transport::get_rank(void) const
+{
+    return m_rank;
+}
+
+uint32_t falcon_simulation_environment_tcp_transport::get_num_ranks(void) const
+{
+    return static_cast<uint32_t>(m_hosts.size());
+}
+
+/*
+ * @brief  Sends and receives concurrently so that two ranks exchanging large
+ *          buffers with each other cannot deadlock on full socket buffers
+ */
+bool falcon_simulation_environment_tcp_transport::exchange(const FalconRankBufferMap &outgoing, FalconRankBufferMap &incoming)
+{
+    std::map<FalconRank, peer_exchange_state> peers;
+
+    for (auto &entry : outgoing)
+    {
+        peer_exchange_state &state = peers[entry.first];
+        state.out = &entry.second;
+        state.out_header = htonl(static_cast<uint32_t>(entry.second.size()));
+        state.out_offset = 0;
+        state.in = nullptr;
+    }
+
+    for (auto &entry : incoming)
+    {
+        if (outgoing.find(entry.first) == outgoing.end())
+        {
+            peers[entry.first].out = nullptr;
+        }
+
+        peer_exchange_state &state = peers[entry.first];
+        state.in = &entry.second;
+        state.in_header = 0;
+        state.in_size = 0;
+        state.in_offset = 0;
+        entry.second.clear();
+    }
+
+    for (auto &entry : peers)
+    {
+        if (entry.first >= m_peer_fds.size() || m_peer_fds[entry.first] < 0)
+        {
+            BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " has no connection to rank " << entry.first;
+            return false;
+        }
+
+        entry.second.fd = m_peer_fds[entry.first];
+    }
+
+    std::vector<struct pollfd> pfds;
+    bool failed = false;
+
+    while (!failed)
+    {
+        pfds.clear();
+
+        for (auto &entry : peers)
+        {
+            peer_exchange_state &state = entry.second;
+
+            struct pollfd pfd;
+            pfd.fd = state.fd;
+            pfd.events = 0;
+            pfd.revents = 0;
+
+            if (state.out != nullptr && progress_send(state, failed))
+            {
+                state.out = nullptr;
+            }
+
+            if (state.in != nullptr && progress_recv(state, failed))
+            {
+                state.in = nullptr;
+            }
+
+            pfd.events |= (state.out != nullptr) ? POLLOUT : 0;
+            pfd.events |= (state.in != nullptr) ? POLLIN : 0;
+
+            if (pfd.events != 0)
+            {
+                pfds.push_back(pfd);
+            }
+        }
+
+        if (failed || pfds.empty())
+        {
+            break;
+        }
+
+        int ret = poll(pfds.data(), pfds.size(), FALCON_TCP_TRANSPORT_IO_TIMEOUT_MS);
+        if (ret == 0 || (ret < 0 && errno != EINTR))
+        {
+            BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " timed out exchanging data with its peers";
+            failed = true;
+        }
+    }
+
+    return !failed;
+}
+
+int falcon_simulation_environment_tcp_transport::listen_for_peers(void)
+{
+    struct addrinfo hints;
+    struct addrinfo *result = nullptr;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+
+    std::string port = std::to_string(m_base_port + m_rank);
+    if (getaddrinfo(m_hosts[m_rank].c_str(), port.c_str(), &hints, &result) != 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Unable to resolve " << m_hosts[m_rank];
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *ai = result; ai != nullptr && fd < 0; ai = ai->ai_next)
+    {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        int enable = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) != 0 || listen(fd, static_cast<int>(m_hosts.size())) != 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    freeaddrinfo(result);
+
+    if (fd < 0)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " unable to listen on port " << port;
+    }
+
+    return fd;
+}
+
+/*
+ * @brief  Connects to a lower rank, retrying until it is listening
+ */
+int falcon_simulation_environment_tcp_transport::connect_to_peer(FalconRank peer)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    std::string port = std::to_string(m_base_port + peer);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(FALCON_TCP_TRANSPORT_CONNECT_TIMEOUT_MS);
+
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        struct addrinfo *result = nullptr;
+        if (getaddrinfo(m_hosts[peer].c_str(), port.c_str(), &hints, &result) == 0)
+        {
+            for (struct addrinfo *ai = result; ai != nullptr; ai = ai->ai_next)
+            {
+                int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+                if (fd < 0)
+                {
+                    continue;
+                }
+
+                if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+                {
+                    freeaddrinfo(result);
+                    return fd;
+                }
+
+                close(fd);
+            }
+
+            freeaddrinfo(result);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(CONNECT_RETRY_INTERVAL_MS));
+    }
+
+    BOOST_LOG_TRIVIAL(error) << "Rank " << m_rank << " unable to connect to rank " << peer;
+    return -1;
+}
+
+bool falcon_simulation_environment_tcp_transport::configure_peer_socket(int fd)
+{
+    int enable = 1;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable)) != 0)
+    {
+        return false;
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    return (flags >= 0) && (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+}
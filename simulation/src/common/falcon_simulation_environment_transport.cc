@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_transport.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment inter-process transport interface.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the collective operations shared by all transports in terms of
+ *  the point-to-point exchange() primitive. Rank 0 acts as the root of every
+ *  collective operation. Reduced values travel in network byte order.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Reduce values in network byte order.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <endian.h>
+#include <string.h>
+
+#include "common/falcon_simulation_environment_transport.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const FalconRank ROOT_RANK = 0;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static void encode_values(const std::vector<int64_t> &values, FalconTransportBuffer &buffer)
+{
+    buffer.resize(values.size() * sizeof(int64_t));
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        uint64_t value = htobe64(static_cast<uint64_t>(values[ii]));
+        memcpy(buffer.data() + ii * sizeof(value), &value, sizeof(value));
+    }
+}
+
+static int64_t decode_value(const FalconTransportBuffer &buffer, size_t idx)
+{
+    uint64_t value = 0;
+    memcpy(&value, buffer.data() + idx * sizeof(value), sizeof(value));
+    return static_cast<int64_t>(be64toh(value));
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_transport::falcon_simulation_environment_transport(void)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_transport::~falcon_simulation_environment_transport(void)
+{
+    /* no action required at this time */
+}
+
+/*
+ * @brief  Replaces every rank's values with the element-wise sum across ranks
+ *
+ * Doubles as a global barrier since no rank can return before every rank has
+ *  contributed its values.
+ */
+bool falcon_simulation_environment_transport::all_reduce_sum(std::vector<int64_t> &values)
+{
+    const size_t num_bytes = values.size() * sizeof(int64_t);
+
+    if (get_num_ranks() <= 1)
+    {
+        return true;
+    }
+
+    FalconRankBufferMap outgoing;
+    FalconRankBufferMap incoming;
+
+    if (get_rank() == ROOT_RANK)
+    {
+        for (FalconRank peer = 0; peer < get_num_ranks(); ++peer)
+        {
+            if (peer != ROOT_RANK)
+            {
+                incoming[peer] = FalconTransportBuffer();
+            }
+        }
+
+        if (!exchange(outgoing, incoming))
+        {
+            return false;
+        }
+
+        for (auto &entry : incoming)
+        {
+            if (entry.second.size() != num_bytes)
+            {
+                return false;
+            }
+
+            for (size_t ii = 0; ii < values.size(); ++ii)
+            {
+                values[ii] += decode_value(entry.second, ii);
+            }
+        }
+
+        FalconTransportBuffer result;
+        encode_values(values, result);
+
+        incoming.clear();
+        for (FalconRank peer = 0; peer < get_num_ranks(); ++peer)
+        {
+            if (peer != ROOT_RANK)
+            {
+                outgoing[peer] = result;
+            }
+        }
+
+        return exchange(outgoing, incoming);
+    }
+
+    encode_values(values, outgoing[ROOT_RANK]);
+
+    if (!exchange(outgoing, incoming))
+    {
+        return false;
+    }
+
+    outgoing.clear();
+    incoming[ROOT_RANK] = FalconTransportBuffer();
+    if (!exchange(outgoing, incoming) || incoming[ROOT_RANK].size() != num_bytes)
+    {
+        return false;
+    }
+
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        values[ii] = decode_value(incoming[ROOT_RANK], ii);
+    }
+
+    return true;
+}
+
+bool falcon_simulation_environment_transport::barrier(void)
+{
+    std::vector<int64_t> no_values;
+    return all_reduce_sum(no_values);
+}
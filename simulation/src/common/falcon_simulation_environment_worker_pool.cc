@@ -0,0 +1,422 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     falcon_simulation_environment_worker_pool.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    FALCON Simulation Environment worker thread pool.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a persistent pool of worker threads used by the simulation
+ *  environment manager to advance independent components concurrently. Tasks
+ *  within a batch are claimed through a shared atomic index so that faster
+ *  threads naturally pick up more of the work.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added queue depth for metrics.
+ * 19-Oct-2026  OrthogonalHawk  Added assigned tasks and CPU affinity.
+ * 19-Oct-2026  OrthogonalHawk  Fixed stale batches after re-initialization.
+ * 19-Oct-2026  OrthogonalHawk  Added steal groups.
+ * 19-Oct-2026  OrthogonalHawk  Queue depth is read without the pool mutex.
+ * 19-Oct-2026  OrthogonalHawk  Restore the caller's CPU affinity on shutdown.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+
+#include "common/falcon_simulation_environment_worker_pool.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+falcon_simulation_environment_worker_pool::falcon_simulation_environment_worker_pool(void)
+  : m_generation(0),
+    m_active_workers(0),
+    m_shutdown_requested(false),
+    m_task(nullptr),
+    m_num_tasks(0),
+    m_next_task_idx(0),
+    m_num_dispatched_tasks(0),
+    m_num_dispatched_lists(0),
+    m_assignment(nullptr),
+    m_cursors(nullptr),
+    m_num_cursors(0),
+    m_caller_pinned(false)
+{
+    /* no action required at this time */
+}
+
+falcon_simulation_environment_worker_pool::~falcon_simulation_environment_worker_pool(void)
+{
+    shutdown();
+}
+
+/*
+ * @brief  Starts the worker threads
+ *
+ * @param  num_threads Total number of threads, including the calling thread,
+ *                      that will execute tasks.
+ *
+ * @return True if the pool was started; false if it was already running.
+ */
+bool falcon_simulation_environment_worker_pool::initialize(uint32_t num_threads)
+{
+    if (!m_threads.empty())
+    {
+        return false;
+    }
+
+    m_shutdown_requested = false;
+    m_steal_groups.clear();
+
+    /* workers must only run batches dispatched after they were started, even
+     *  if the pool has already been used and shut down */
+    uint64_t start_generation = m_generation;
+
+    /* the thread that calls parallel_for also executes tasks */
+    for (uint32_t ii = 1; ii < num_threads; ++ii)
+    {
+        m_threads.push_back(std::thread(&falcon_simulation_environment_worker_pool::worker_thread_main, this, ii, start_generation));
+    }
+
+    return true;
+}
+
+/*
+ * @brief  Executes task(0) through task(num_tasks - 1) across the pool
+ *
+ * Blocks until every task has completed. Must not be called concurrently
+ *  from more than one thread.
+ */
+void falcon_simulation_environment_worker_pool::parallel_for(uint32_t num_tasks, const FalconWorkerTask &task)
+{
+    /* avoid waking the workers when there is nothing to share */
+    if (m_threads.empty() || num_tasks <= 1)
+    {
+        for (uint32_t ii = 0; ii < num_tasks; ++ii)
+        {
+            task(ii);
+        }
+
+        return;
+    }
+
+    dispatch(task, num_tasks, nullptr);
+}
+
+/*
+ * @brief  Executes every task listed in the assignment across the pool
+ *
+ * Each thread executes its own list first and then steals unclaimed tasks
+ *  from the lists of the other threads in its steal group, so an assignment
+ *  planned from stale costs still completes without idling threads. Blocks
+ *  until every task has completed.
+ */
+void falcon_simulation_environment_worker_pool::parallel_for_assigned(const FalconThreadTaskLists &assignment, const FalconWorkerTask &task)
+{
+    if (m_threads.empty())
+    {
+        for (auto &tasks : assignment)
+        {
+            for (auto task_idx : tasks)
+            {
+                task(task_idx);
+            }
+        }
+
+        return;
+    }
+
+    dispatch(task, 0, &assignment);
+}
+
+/*
+ * @brief  Pins the calling thread and every worker thread to a CPU
+ *
+ * @param  cpus CPUs in order of preference; thread N is pinned to
+ *          cpus[N % cpus.size()], where thread zero is the calling thread.
+ *
+ * The calling thread executes a share of every batch, so it should be the
+ *  thread that goes on to call parallel_for() and parallel_for_assigned().
+ *  Its previous affinity is saved and restored by shutdown(), which must
+ *  therefore be called before that thread exits.
+ *
+ * @return True if every thread was pinned.
+ */
+bool falcon_simulation_environment_worker_pool::pin_threads(const std::vector<uint32_t> &cpus)
+{
+    if (cpus.empty())
+    {
+        return false;
+    }
+
+    /* a different caller first gets back the affinity it had */
+    if (m_caller_pinned && !pthread_equal(m_pinned_caller, pthread_self()))
+    {
+        restore_caller_affinity();
+    }
+
+    if (!m_caller_pinned)
+    {
+        m_pinned_caller = pthread_self();
+        m_caller_pinned = (pthread_getaffinity_np(m_pinned_caller, sizeof(m_caller_cpu_set), &m_caller_cpu_set) == 0);
+        if (!m_caller_pinned)
+        {
+            return false;
+        }
+    }
+
+    bool ret = true;
+    for (size_t ii = 0; ii <= m_threads.size(); ++ii)
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpus[ii % cpus.size()], &cpu_set);
+
+        pthread_t thread = (ii == 0) ? pthread_self() : m_threads[ii - 1].native_handle();
+        ret = (pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set) == 0) && ret;
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Restricts work stealing to threads in the same group
+ *
+ * @param  thread_groups Group of each thread, where thread zero is the thread
+ *          calling parallel_for_assigned(); empty to let every thread steal
+ *          from every other. Must not be called while a batch is executing.
+ *
+ * A thread always completes its own list, so every task still runs.
+ */
+void falcon_simulation_environment_worker_pool::set_steal_groups(const std::vector<uint32_t> &thread_groups)
+{
+    m_steal_groups = thread_groups;
+}
+
+/*
+ * @brief  Stops and joins the worker threads
+ */
+void falcon_simulation_environment_worker_pool::shutdown(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown_requested = true;
+    }
+    m_start_cv.notify_all();
+
+    for (auto &thread : m_threads)
+    {
+        thread.join();
+    }
+
+    m_threads.clear();
+
+    restore_caller_affinity();
+}
+
+uint32_t falcon_simulation_environment_worker_pool::get_num_threads(void) const
+{
+    return static_cast<uint32_t>(m_threads.size()) + 1;
+}
+
+/*
+ * @brief  Number of tasks of the current batch not yet claimed by a thread;
+ *          safe to call from any thread
+ *
+ * Only reads atomics, so sampling never contends with dispatch() for the
+ *  mutex. A sample taken while one batch ends and the next begins may mix
+ *  the two.
+ */
+uint32_t falcon_simulation_environment_worker_pool::get_queue_depth(void)
+{
+    const uint32_t num_tasks = m_num_dispatched_tasks.load(std::memory_order_acquire);
+    const uint32_t next_task_idx = m_next_task_idx.load(std::memory_order_relaxed);
+    uint32_t ret = num_tasks - std::min(num_tasks, next_task_idx);
+
+    /* loaded after the list count, so the buffer holds at least that many */
+    const uint32_t num_lists = m_num_dispatched_lists.load(std::memory_order_acquire);
+    const assigned_list_cursor *cursors = m_cursors.load(std::memory_order_acquire);
+    for (uint32_t ii = 0; ii < num_lists; ++ii)
+    {
+        const uint32_t list_tasks = cursors[ii].num_tasks.load(std::memory_order_relaxed);
+        ret += list_tasks - std::min(list_tasks, cursors[ii].next_idx.load(std::memory_order_relaxed));
+    }
+
+    return ret;
+}
+
+/*
+ * @brief  Hands a batch of tasks to the worker threads, joins in, and waits
+ *          for the batch to complete
+ */
+void falcon_simulation_environment_worker_pool::dispatch(const FalconWorkerTask &task, uint32_t num_tasks, const FalconThreadTaskLists *assignment)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_task = &task;
+        m_num_tasks = num_tasks;
+        m_next_task_idx.store(0, std::memory_order_relaxed);
+
+        m_assignment = assignment;
+        if (assignment != nullptr)
+        {
+            if (assignment->size() > m_num_cursors)
+            {
+                m_num_cursors = assignment->size();
+                m_cursor_buffers.emplace_back(new assigned_list_cursor[m_num_cursors]);
+                m_cursors.store(m_cursor_buffers.back().get(), std::memory_order_release);
+            }
+
+            assigned_list_cursor *cursors = m_cursors.load(std::memory_order_relaxed);
+            for (size_t ii = 0; ii < assignment->size(); ++ii)
+            {
+                cursors[ii].next_idx.store(0, std::memory_order_relaxed);
+                cursors[ii].num_tasks.store(static_cast<uint32_t>((*assignment)[ii].size()), std::memory_order_relaxed);
+            }
+            m_num_dispatched_lists.store(static_cast<uint32_t>(assignment->size()), std::memory_order_release);
+        }
+        else
+        {
+            m_num_dispatched_tasks.store(num_tasks, std::memory_order_release);
+        }
+
+        m_active_workers = static_cast<uint32_t>(m_threads.size());
+        m_generation++;
+    }
+    m_start_cv.notify_all();
+
+    execute_tasks(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this]{ return m_active_workers == 0; });
+
+    m_num_dispatched_tasks.store(0, std::memory_order_relaxed);
+    m_num_dispatched_lists.store(0, std::memory_order_relaxed);
+    m_task = nullptr;
+    m_assignment = nullptr;
+}
+
+void falcon_simulation_environment_worker_pool::worker_thread_main(uint32_t thread_idx, uint64_t start_generation)
+{
+    uint64_t last_generation = start_generation;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start_cv.wait(lock, [this, last_generation]{ return m_shutdown_requested || m_generation != last_generation; });
+
+            if (m_shutdown_requested)
+            {
+                break;
+            }
+
+            last_generation = m_generation;
+        }
+
+        execute_tasks(thread_idx);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_active_workers--;
+        }
+        m_done_cv.notify_one();
+    }
+}
+
+void falcon_simulation_environment_worker_pool::execute_tasks(uint32_t thread_idx)
+{
+    if (m_assignment == nullptr)
+    {
+        uint32_t task_idx = m_next_task_idx.fetch_add(1, std::memory_order_relaxed);
+        while (task_idx < m_num_tasks)
+        {
+            (*m_task)(task_idx);
+            task_idx = m_next_task_idx.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return;
+    }
+
+    /* own list first, then the lists of the following threads in the same
+     *  steal group */
+    const size_t num_lists = m_assignment->size();
+    const size_t num_groups = m_steal_groups.size();
+    assigned_list_cursor *cursors = m_cursors.load(std::memory_order_relaxed);
+    for (size_t ii = 0; ii < num_lists; ++ii)
+    {
+        const size_t list_idx = (thread_idx + ii) % num_lists;
+        if (ii > 0 && thread_idx < num_groups && list_idx < num_groups &&
+            m_steal_groups[list_idx] != m_steal_groups[thread_idx])
+        {
+            continue;
+        }
+        const std::vector<uint32_t> &tasks = (*m_assignment)[list_idx];
+        std::atomic<uint32_t> &next_idx = cursors[list_idx].next_idx;
+
+        uint32_t position = next_idx.fetch_add(1, std::memory_order_relaxed);
+        while (position < tasks.size())
+        {
+            (*m_task)(tasks[position]);
+            position = next_idx.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void falcon_simulation_environment_worker_pool::restore_caller_affinity(void)
+{
+    if (m_caller_pinned)
+    {
+        pthread_setaffinity_np(m_pinned_caller, sizeof(m_caller_cpu_set), &m_caller_cpu_set);
+        m_caller_pinned = false;
+    }
+}
@@ -40,6 +40,7 @@
  * @section  HISTORY
  *
  * 24-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Run registered scenarios and parameter sweeps.
  *
  *****************************************************************************/
 
@@ -49,6 +50,12 @@
 
 #include "falcon_log.h"
 
+#include "common/falcon_simulation_environment_batch_runner.h"
+#include "common/falcon_simulation_environment_component_arg_parser.h"
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+#include "common/falcon_simulation_environment_sweep_spec.h"
+
 /******************************************************************************
  *                                 CONSTANTS
  *****************************************************************************/
@@ -65,15 +72,72 @@
  *                            CLASS IMPLEMENTATION
  *****************************************************************************/
 
-#include <stdio.h>
+static int run_sweep(falcon_simulation_environment_component_arg_parser &arg_parser)
+{
+    falcon_simulation_environment_sweep_spec spec;
+    if (!spec.load(arg_parser.get_sweep_path()))
+    {
+        return 1;
+    }
+
+    falcon_simulation_environment_batch_runner runner;
+    FALCON_BATCH_RUNNER_STATUS_ENUM ret = runner.run(spec, arg_parser.get_sweep_results_path(),
+                                                     arg_parser.get_num_sweep_workers());
+    if (ret != FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Sweep failed: " << runner.get_batch_runner_status_str(ret);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int run_scenario(falcon_simulation_environment_component_arg_parser &arg_parser, int argc, char **argv)
+{
+    falcon_simulation_environment_manager manager;
+
+    FALCON_MANAGER_STATUS_ENUM ret =
+        falcon_simulation_environment_scenario_registry::get_instance().add_scenario_components(arg_parser.get_scenario_name(), manager);
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        ret = manager.initialize(argc, argv);
+    }
+
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        ret = manager.run_simulation();
+    }
+
+    FALCON_MANAGER_STATUS_ENUM shutdown_ret = manager.shutdown();
+    if (ret == FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        ret = shutdown_ret;
+    }
+
+    if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+    {
+        BOOST_LOG_TRIVIAL(error) << "Simulation failed: " << manager.get_manager_status_str(ret);
+        return 1;
+    }
+
+    return 0;
+}
 
 int main(int argc, char **argv)
 {
-	falcon_log logger;
-	logger.initialize();
+    falcon_log logger;
+    logger.initialize();
+
+    falcon_simulation_environment_component_arg_parser arg_parser;
+    if (!arg_parser.parse_args(argc, argv))
+    {
+        return 1;
+    }
 
-	BOOST_LOG_TRIVIAL(info) << "An informational severity message";
+    if (!arg_parser.get_sweep_path().empty())
+    {
+        return run_sweep(arg_parser);
+    }
 
-    printf("Hello World\n");
-	return 0;
+    return run_scenario(arg_parser, argc, argv);
 }
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     simulation_test.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Minimal unit test harness for the FALCON simulation module.
+ *
+ * @section  DESCRIPTION
+ *
+ * Tests are registered during static initialization with FALCON_TEST() and
+ *  run by simulation_test_main.cc. A failed FALCON_TEST_ASSERT() records the
+ *  failure and returns from the test, so assertions may only be used directly
+ *  in a test body or in a function returning void.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __SIMULATION_TEST_H__
+#define __SIMULATION_TEST_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef std::function<void(void)> FalconTestFunction;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/* defines and registers a test during static initialization */
+#define FALCON_TEST(name) \
+    static void falcon_test_##name(void); \
+    static const bool falcon_test_registered_##name = \
+        falcon_simulation_test_registry::get_instance().register_test(#name, falcon_test_##name); \
+    static void falcon_test_##name(void)
+
+#define FALCON_TEST_ASSERT(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            falcon_simulation_test_registry::get_instance().fail(__FILE__, __LINE__, #condition); \
+            return; \
+        } \
+    } while (0)
+
+#define FALCON_TEST_ASSERT_EQ(expected, actual) \
+    do \
+    { \
+        auto falcon_test_expected = (expected); \
+        auto falcon_test_actual = (actual); \
+        if (!(falcon_test_expected == falcon_test_actual)) \
+        { \
+            std::stringstream falcon_test_ss; \
+            falcon_test_ss << #expected << " == " << #actual << " (" << falcon_test_expected \
+                           << " != " << falcon_test_actual << ")"; \
+            falcon_simulation_test_registry::get_instance().fail(__FILE__, __LINE__, falcon_test_ss.str()); \
+            return; \
+        } \
+    } while (0)
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class falcon_simulation_test_registry
+{
+public:
+
+    static falcon_simulation_test_registry & get_instance(void);
+
+    bool register_test(const std::string &name, FalconTestFunction test);
+    void fail(const char *file, int line, const std::string &condition);
+
+    /* runs every test whose name contains the filter; returns the number of
+     *  failed tests */
+    uint32_t run_tests(const std::string &filter);
+
+private:
+
+    falcon_simulation_test_registry(void);
+
+    std::map<std::string, FalconTestFunction>    m_tests;
+    bool                                         m_current_test_failed;
+};
+
+/******************************************************************************
+ *                           INLINE IMPLEMENTATION
+ *****************************************************************************/
+
+inline falcon_simulation_test_registry & falcon_simulation_test_registry::get_instance(void)
+{
+    static falcon_simulation_test_registry instance;
+    return instance;
+}
+
+inline falcon_simulation_test_registry::falcon_simulation_test_registry(void)
+  : m_current_test_failed(false)
+{
+    /* no action required at this time */
+}
+
+inline bool falcon_simulation_test_registry::register_test(const std::string &name, FalconTestFunction test)
+{
+    return m_tests.insert(std::make_pair(name, test)).second;
+}
+
+inline void falcon_simulation_test_registry::fail(const char *file, int line, const std::string &condition)
+{
+    std::cout << "    " << file << ":" << line << ": assertion failed: " << condition << std::endl;
+    m_current_test_failed = true;
+}
+
+inline uint32_t falcon_simulation_test_registry::run_tests(const std::string &filter)
+{
+    uint32_t num_run = 0;
+    uint32_t num_failed = 0;
+
+    for (auto &entry : m_tests)
+    {
+        if (entry.first.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::cout << "[ RUN  ] " << entry.first << std::endl;
+
+        m_current_test_failed = false;
+        entry.second();
+        num_run++;
+
+        if (m_current_test_failed)
+        {
+            num_failed++;
+            std::cout << "[ FAIL ] " << entry.first << std::endl;
+        }
+        else
+        {
+            std::cout << "[  OK  ] " << entry.first << std::endl;
+        }
+    }
+
+    std::cout << num_run - num_failed << " of " << num_run << " test(s) passed" << std::endl;
+
+    return num_failed;
+}
+
+#endif // __SIMULATION_TEST_H__
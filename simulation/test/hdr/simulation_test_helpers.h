@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+/******************************************************************************
+ *
+ * @file     simulation_test_helpers.h
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Helpers shared by the FALCON simulation unit tests.
+ *
+ * @section  DESCRIPTION
+ *
+ * Declares helpers for tests that need a scratch directory or a parsed
+ *  parameter sweep. Unlike assertions, the helpers report failure through
+ *  their return values, so they may be called from any function.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __SIMULATION_TEST_HELPERS_H__
+#define __SIMULATION_TEST_HELPERS_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string>
+
+#include "common/falcon_simulation_environment_sweep_spec.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            FUNCTION DECLARATIONS
+ *****************************************************************************/
+
+/* creates a uniquely named directory under /tmp; empty on failure */
+std::string make_temp_dir(const std::string &name);
+
+/* removes a directory and everything beneath it */
+void remove_temp_dir(const std::string &dir);
+
+bool parse_sweep(const std::string &text, falcon_simulation_environment_sweep_spec &spec);
+
+#endif // __SIMULATION_TEST_HELPERS_H__
@@ -0,0 +1,94 @@
+###############################################################################
+#
+# MIT License
+#
+# Copyright (c) 2018 OrthogonalHawk
+#
+# See the LICENSE file at the root of this repository for the full text.
+#
+###############################################################################
+
+"""Tests for the Python binding of the FALCON Simulation Environment.
+
+Expects FALCON_SIMULATION_LIBRARY to name a build of the shared library that
+includes the capi_test_echo scenario from src/capi_test_scenario.cc, as built
+by 'make python_test'. Runs with or without NumPy installed.
+"""
+
+import ctypes
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "python"))
+
+import falcon_simulation  # noqa: E402
+
+SCENARIO = "capi_test_echo"
+NUM_COMPONENTS = 3
+VALUES_PER_COMPONENT = 2
+
+
+def _address(view):
+    """Returns the address of the first element of a view."""
+    if falcon_simulation.numpy is not None:
+        return view.ctypes.data
+
+    return ctypes.addressof(view.obj)
+
+
+class FalconSimulationTest(unittest.TestCase):
+
+    def test_unknown_scenario_is_rejected(self):
+        with self.assertRaises(falcon_simulation.FalconSimulationError):
+            falcon_simulation.FalconSimulation("no_such_scenario")
+
+    def test_close_after_failed_initialize(self):
+        sim = falcon_simulation.FalconSimulation(SCENARIO)
+        with self.assertRaises(falcon_simulation.FalconSimulationError):
+            sim.initialize(resume=1, checkpoint_dir="/nonexistent/falcon")
+
+        sim.close()
+        sim.close()
+
+    def test_views_alias_manager_buffers(self):
+        with falcon_simulation.FalconSimulation(SCENARIO) as sim:
+            sim.initialize(threads=2)
+
+            num_values = NUM_COMPONENTS * VALUES_PER_COMPONENT
+            self.assertEqual(num_values, len(sim.observations))
+            self.assertEqual(num_values, len(sim.actions))
+            self.assertEqual(NUM_COMPONENTS, len(sim.rewards))
+
+            observations = sim.observations
+            address = _address(observations)
+
+            for step in range(1, 4):
+                for index in range(num_values):
+                    sim.actions[index] = step * 10 + index
+
+                rewards = sim.step()
+
+                # the views are neither replaced nor copied by step()
+                self.assertIs(observations, sim.observations)
+                self.assertEqual(address, _address(sim.observations))
+                self.assertEqual([2.0 * (step * 10 + index) for index in range(num_values)],
+                                 [float(value) for value in observations])
+                self.assertEqual(list(range(1, NUM_COMPONENTS + 1)), [int(value) for value in rewards])
+                self.assertEqual(step, sim.timestep)
+
+            self.assertEqual(6, sim.timestep_reward)
+            self.assertEqual(18, sim.cumulative_reward)
+
+    def test_step_accepts_an_action_sequence(self):
+        with falcon_simulation.FalconSimulation(SCENARIO) as sim:
+            sim.initialize(threads=1)
+
+            actions = [float(index) for index in range(NUM_COMPONENTS * VALUES_PER_COMPONENT)]
+            sim.step(actions)
+
+            self.assertEqual([2.0 * value for value in actions], [float(value) for value in sim.observations])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,328 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     batch_runner_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the parameter sweep batch runner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Runs small sweeps in a temporary directory and covers resuming from a
+ *  results file, including one whose last line was cut short, rejecting a
+ *  results file written for a different sweep and retrying the trials of
+ *  worker processes that exit.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Use the shared test helpers.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_batch_runner.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+#include "simulation_test.h"
+#include "simulation_test_helpers.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const size_t RESULT_STATUS_FIELD = 4;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+/* each attempt appends a byte to this file; read by the forked workers */
+static std::string batch_runner_test_attempts_path;
+
+/*
+ * @brief  Exits its worker process on the first CrashingAttempts attempts at
+ *          a trial, counted across processes through the attempts file
+ */
+template <uint32_t CrashingAttempts>
+class batch_runner_test_crashing_component : public falcon_simulation_environment_component
+{
+public:
+
+    batch_runner_test_crashing_component(void)
+    {
+        set_component_id(0);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        std::ifstream previous(batch_runner_test_attempts_path, std::ios::binary | std::ios::ate);
+        uint32_t num_attempts = previous.is_open() ? static_cast<uint32_t>(previous.tellg()) : 0;
+        previous.close();
+
+        std::ofstream attempts(batch_runner_test_attempts_path, std::ios::binary | std::ios::app);
+        attempts << 'x';
+        attempts.close();
+
+        if (num_attempts < CrashingAttempts)
+        {
+            _exit(1);
+        }
+
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return 1;
+    }
+};
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+template <uint32_t CrashingAttempts>
+static FALCON_MANAGER_STATUS_ENUM add_batch_runner_test_components(falcon_simulation_environment_manager &manager)
+{
+    return manager.add_component(std::make_shared<batch_runner_test_crashing_component<CrashingAttempts>>());
+}
+
+static std::vector<std::string> read_lines(const std::string &path)
+{
+    std::vector<std::string> ret;
+    std::ifstream input(path);
+    std::string line;
+
+    while (std::getline(input, line))
+    {
+        ret.push_back(line);
+    }
+
+    return ret;
+}
+
+/* trial id -> status of the last result line for that trial */
+static std::map<uint32_t, std::string> read_statuses(const std::string &path)
+{
+    std::map<uint32_t, std::string> ret;
+
+    for (auto &line : read_lines(path))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+
+        if (fields.size() > RESULT_STATUS_FIELD)
+        {
+            ret[static_cast<uint32_t>(strtoul(fields[0].c_str(), nullptr, 10))] = fields[RESULT_STATUS_FIELD];
+        }
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_REGISTER_SCENARIO(batch_runner_test_crash_once, add_batch_runner_test_components<1>);
+FALCON_REGISTER_SCENARIO(batch_runner_test_crash_always, add_batch_runner_test_components<UINT32_MAX>);
+
+FALCON_TEST(batch_runner_resumes_from_results_file)
+{
+    std::string dir = make_temp_dir("falcon_batch_runner_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+    std::string results_path = dir + "/results.tsv";
+
+    falcon_simulation_environment_sweep_spec spec;
+    FALCON_TEST_ASSERT(parse_sweep("scenario = empty\nduration = 2\nseeds = 1-4\n", spec));
+
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 2) == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS);
+    }
+
+    std::vector<std::string> lines = read_lines(results_path);
+    FALCON_TEST_ASSERT_EQ(6u, lines.size());
+    FALCON_TEST_ASSERT_EQ(4u, read_statuses(results_path).size());
+
+    /* a complete rerun has nothing left to do */
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 2) == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS);
+    }
+    FALCON_TEST_ASSERT(read_lines(results_path) == lines);
+
+    /* mark one trial as failed and cut the last line short, as if the sweep
+     *  had been killed while writing it */
+    std::map<uint32_t, std::string> statuses = read_statuses(results_path);
+    std::ofstream rewritten(results_path, std::ios::trunc);
+    uint32_t failed_trial = 0;
+    uint32_t cut_trial = 0;
+    for (size_t ii = 0; ii < lines.size(); ++ii)
+    {
+        if (ii == 2)
+        {
+            failed_trial = static_cast<uint32_t>(strtoul(lines[ii].c_str(), nullptr, 10));
+            size_t status_start = lines[ii].find("SUCCESS");
+            rewritten << lines[ii].substr(0, status_start) << "COMPONENT_FAILURE"
+                      << lines[ii].substr(status_start + 7) << '\n';
+        }
+        else if (ii == lines.size() - 1)
+        {
+            cut_trial = static_cast<uint32_t>(strtoul(lines[ii].c_str(), nullptr, 10));
+            rewritten << lines[ii].substr(0, lines[ii].size() / 2);
+        }
+        else
+        {
+            rewritten << lines[ii] << '\n';
+        }
+    }
+    rewritten.close();
+
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 1) == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS);
+    }
+
+    /* the partial line is gone and both trials were rerun exactly once */
+    std::vector<std::string> resumed_lines = read_lines(results_path);
+    FALCON_TEST_ASSERT_EQ(7u, resumed_lines.size());
+    FALCON_TEST_ASSERT(failed_trial != cut_trial);
+    statuses = read_statuses(results_path);
+    FALCON_TEST_ASSERT_EQ(4u, statuses.size());
+    for (auto &entry : statuses)
+    {
+        FALCON_TEST_ASSERT_EQ(std::string("SUCCESS"), entry.second);
+    }
+
+    remove_temp_dir(dir);
+}
+
+FALCON_TEST(batch_runner_rejects_results_of_a_different_sweep)
+{
+    std::string dir = make_temp_dir("falcon_batch_runner_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+    std::string results_path = dir + "/results.tsv";
+
+    falcon_simulation_environment_sweep_spec spec;
+    falcon_simulation_environment_sweep_spec other_spec;
+    FALCON_TEST_ASSERT(parse_sweep("scenario = empty\nduration = 1\nseeds = 1-2\n", spec));
+    FALCON_TEST_ASSERT(parse_sweep("scenario = empty\nduration = 1\nseeds = 1-3\n", other_spec));
+
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 1) == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS);
+    }
+    std::vector<std::string> lines = read_lines(results_path);
+
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(other_spec, results_path, 1) == FALCON_BATCH_RUNNER_STATUS_ENUM::INVALID_RESULTS_FILE);
+    }
+    FALCON_TEST_ASSERT(read_lines(results_path) == lines);
+
+    remove_temp_dir(dir);
+}
+
+FALCON_TEST(batch_runner_retries_trials_of_exited_workers)
+{
+    std::string dir = make_temp_dir("falcon_batch_runner_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+    std::string results_path = dir + "/results.tsv";
+    batch_runner_test_attempts_path = dir + "/attempts";
+
+    /* the first attempt exits, the retry on a replacement worker succeeds */
+    falcon_simulation_environment_sweep_spec spec;
+    FALCON_TEST_ASSERT(parse_sweep("scenario = batch_runner_test_crash_once\nduration = 1\n", spec));
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 1) == FALCON_BATCH_RUNNER_STATUS_ENUM::SUCCESS);
+    }
+    FALCON_TEST_ASSERT_EQ(std::string("SUCCESS"), read_statuses(results_path)[0]);
+    FALCON_TEST_ASSERT_EQ(3u, read_lines(results_path).size());
+
+    /* a trial that always exits gives up after the last attempt */
+    unlink(results_path.c_str());
+    unlink(batch_runner_test_attempts_path.c_str());
+    FALCON_TEST_ASSERT(parse_sweep("scenario = batch_runner_test_crash_always, empty\nduration = 1\n", spec));
+    {
+        falcon_simulation_environment_batch_runner runner;
+        FALCON_TEST_ASSERT(runner.run(spec, results_path, 2) == FALCON_BATCH_RUNNER_STATUS_ENUM::TRIAL_FAILURE);
+    }
+
+    std::map<uint32_t, std::string> statuses = read_statuses(results_path);
+    FALCON_TEST_ASSERT_EQ(std::string(FALCON_BATCH_WORKER_EXITED_STR), statuses[0]);
+    FALCON_TEST_ASSERT_EQ(std::string("SUCCESS"), statuses[1]);
+
+    std::ifstream attempts(batch_runner_test_attempts_path, std::ios::binary | std::ios::ate);
+    FALCON_TEST_ASSERT_EQ(static_cast<std::streamoff>(FALCON_BATCH_MAX_TRIAL_ATTEMPTS), static_cast<std::streamoff>(attempts.tellg()));
+
+    remove_temp_dir(dir);
+}
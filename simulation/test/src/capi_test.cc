@@ -0,0 +1,178 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     capi_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the C interface.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers argument checking, the handle lifecycle after a failed initialize
+ *  and that the step buffers are the manager's own, using the scenario
+ *  registered by capi_test_scenario.cc.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string.h>
+
+#include "common/falcon_simulation_environment_c_api.h"
+#include "common/falcon_simulation_environment_manager.h"
+
+#include "capi_test_scenario.h"
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const int SUCCESS_STATUS = static_cast<int>(FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(capi_rejects_null_handles_and_pointers)
+{
+    size_t count = 1;
+
+    FALCON_TEST_ASSERT(falcon_simulation_create(nullptr) == nullptr);
+    FALCON_TEST_ASSERT(falcon_simulation_create("no_such_scenario") == nullptr);
+
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_initialize(nullptr, 0, nullptr));
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_step(nullptr));
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_snapshot(nullptr));
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_reset(nullptr));
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_shutdown(nullptr));
+    FALCON_TEST_ASSERT(falcon_simulation_get_observations(nullptr, &count) == nullptr);
+    FALCON_TEST_ASSERT_EQ(0u, count);
+    FALCON_TEST_ASSERT_EQ(0u, falcon_simulation_get_current_timestep(nullptr));
+    FALCON_TEST_ASSERT(strcmp("INVALID_ARGUMENT", falcon_simulation_get_status_str(nullptr, FALCON_SIMULATION_INVALID_ARGUMENT)) == 0);
+    falcon_simulation_destroy(nullptr);
+
+    falcon_simulation *sim = falcon_simulation_create(CAPI_TEST_ECHO_SCENARIO_NAME);
+    FALCON_TEST_ASSERT(sim != nullptr);
+
+    /* a positive count with no vector, and a null entry in the vector */
+    const char *args[] = { "--threads", nullptr };
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_initialize(sim, 2, nullptr));
+    FALCON_TEST_ASSERT_EQ(FALCON_SIMULATION_INVALID_ARGUMENT, falcon_simulation_initialize(sim, -1, args));
+    FALCON_TEST_ASSERT(falcon_simulation_get_actions(sim, nullptr) == nullptr);
+    FALCON_TEST_ASSERT_EQ(static_cast<int>(FALCON_MANAGER_STATUS_ENUM::INITIALIZATION_FAILED),
+                          falcon_simulation_initialize(sim, 2, args));
+
+    falcon_simulation_destroy(sim);
+}
+
+FALCON_TEST(capi_close_after_failed_initialize_is_a_no_op)
+{
+    falcon_simulation *sim = falcon_simulation_create(CAPI_TEST_ECHO_SCENARIO_NAME);
+    FALCON_TEST_ASSERT(sim != nullptr);
+
+    /* fails after the components and worker threads have been started */
+    const char *args[] = { "--threads", "2", "--resume", "1", "--checkpoint-dir", "/nonexistent/falcon" };
+    int status = falcon_simulation_initialize(sim, 6, args);
+    FALCON_TEST_ASSERT(status != SUCCESS_STATUS);
+    FALCON_TEST_ASSERT(falcon_simulation_get_status_str(sim, status) != nullptr);
+
+    FALCON_TEST_ASSERT_EQ(SUCCESS_STATUS, falcon_simulation_shutdown(sim));
+    FALCON_TEST_ASSERT_EQ(SUCCESS_STATUS, falcon_simulation_shutdown(sim));
+
+    /* initialize is not repeatable, even after a failure */
+    FALCON_TEST_ASSERT_EQ(static_cast<int>(FALCON_MANAGER_STATUS_ENUM::UNSUPPORTED_MANAGER_STATE_TRANSITION),
+                          falcon_simulation_initialize(sim, 0, nullptr));
+
+    falcon_simulation_destroy(sim);
+}
+
+FALCON_TEST(capi_step_buffers_are_shared_with_the_manager)
+{
+    falcon_simulation *sim = falcon_simulation_create(CAPI_TEST_ECHO_SCENARIO_NAME);
+    FALCON_TEST_ASSERT(sim != nullptr);
+
+    const char *args[] = { "--threads", "2" };
+    FALCON_TEST_ASSERT_EQ(SUCCESS_STATUS, falcon_simulation_initialize(sim, 2, args));
+
+    size_t num_observations = 0;
+    size_t num_actions = 0;
+    size_t num_rewards = 0;
+    float *observations = falcon_simulation_get_observations(sim, &num_observations);
+    float *actions = falcon_simulation_get_actions(sim, &num_actions);
+    int32_t *rewards = falcon_simulation_get_rewards(sim, &num_rewards);
+
+    const size_t num_values = CAPI_TEST_ECHO_NUM_COMPONENTS * CAPI_TEST_ECHO_VALUES_PER_COMPONENT;
+    FALCON_TEST_ASSERT_EQ(num_values, num_observations);
+    FALCON_TEST_ASSERT_EQ(num_values, num_actions);
+    FALCON_TEST_ASSERT_EQ(static_cast<size_t>(CAPI_TEST_ECHO_NUM_COMPONENTS), num_rewards);
+
+    for (uint32_t step = 1; step <= 3; ++step)
+    {
+        for (size_t ii = 0; ii < num_actions; ++ii)
+        {
+            actions[ii] = static_cast<float>(step * 10 + ii);
+        }
+
+        FALCON_TEST_ASSERT_EQ(SUCCESS_STATUS, falcon_simulation_step(sim));
+        FALCON_TEST_ASSERT_EQ(step, falcon_simulation_get_current_timestep(sim));
+
+        /* the same pointers are returned, and see this step's results */
+        size_t count = 0;
+        FALCON_TEST_ASSERT(falcon_simulation_get_observations(sim, &count) == observations);
+        for (size_t ii = 0; ii < num_observations; ++ii)
+        {
+            FALCON_TEST_ASSERT_EQ(2.0f * actions[ii], observations[ii]);
+        }
+
+        for (size_t ii = 0; ii < num_rewards; ++ii)
+        {
+            FALCON_TEST_ASSERT_EQ(static_cast<int32_t>(ii) + 1, rewards[ii]);
+        }
+    }
+
+    FALCON_TEST_ASSERT_EQ(6, falcon_simulation_get_timestep_reward(sim));
+    FALCON_TEST_ASSERT_EQ(18, falcon_simulation_get_cumulative_reward(sim));
+
+    FALCON_TEST_ASSERT_EQ(SUCCESS_STATUS, falcon_simulation_shutdown(sim));
+    falcon_simulation_destroy(sim);
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     capi_test_scenario.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Scenario used to test the C interface and its Python binding.
+ *
+ * @section  DESCRIPTION
+ *
+ * Registers the "capi_test_echo" scenario. Each of its components writes
+ *  twice its actions into its observations and earns a reward of its id plus
+ *  one every timestep, so a caller can tell whether it is reading and writing
+ *  the manager's buffers directly. The file is linked into both the unit test
+ *  executable and the shared library loaded by python/test_falcon_simulation.py.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <memory>
+
+#include "common/falcon_simulation_environment_component.h"
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_scenario_registry.h"
+
+#include "capi_test_scenario.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+class capi_test_echo_component : public falcon_simulation_environment_component
+{
+public:
+
+    explicit capi_test_echo_component(FalconComponentId id)
+    {
+        set_component_id(id);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        FalconObservationValue *observations = get_observation_buffer();
+        const FalconActionValue *actions = get_action_buffer();
+        for (uint32_t ii = 0; ii < CAPI_TEST_ECHO_VALUES_PER_COMPONENT; ++ii)
+        {
+            observations[ii] = 2 * actions[ii];
+        }
+
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return static_cast<int32_t>(get_component_id()) + 1;
+    }
+
+    uint32_t get_observation_size(void) override
+    {
+        return CAPI_TEST_ECHO_VALUES_PER_COMPONENT;
+    }
+
+    uint32_t get_action_size(void) override
+    {
+        return CAPI_TEST_ECHO_VALUES_PER_COMPONENT;
+    }
+};
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+static FALCON_MANAGER_STATUS_ENUM add_capi_test_echo_components(falcon_simulation_environment_manager &manager)
+{
+    for (FalconComponentId id = 0; id < CAPI_TEST_ECHO_NUM_COMPONENTS; ++id)
+    {
+        FALCON_MANAGER_STATUS_ENUM ret = manager.add_component(std::make_shared<capi_test_echo_component>(id));
+        if (ret != FALCON_MANAGER_STATUS_ENUM::SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    return FALCON_MANAGER_STATUS_ENUM::SUCCESS;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_REGISTER_SCENARIO(capi_test_echo, add_capi_test_echo_components);
@@ -0,0 +1,291 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     channel_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the inter-component message channels.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers SPSC ordering (single-threaded and across a producer and consumer
+ *  thread), ring buffer wrap-around and overflow, refusal to deliver messages
+ *  published during the current timestep, MPSC lane fairness and serializing
+ *  queued messages for checkpoints.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Cover serializing queued messages.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include "common/falcon_simulation_environment_channel.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t NUM_THREADED_MESSAGES = 200000;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(ring_buffer_preserves_fifo_order)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(16);
+
+    for (uint32_t ii = 0; ii < 16; ++ii)
+    {
+        FALCON_TEST_ASSERT(ring.push(0, ii));
+    }
+    FALCON_TEST_ASSERT_EQ(16u, ring.size());
+
+    uint32_t message = 0;
+    for (uint32_t ii = 0; ii < 16; ++ii)
+    {
+        FALCON_TEST_ASSERT(ring.pop(1, message));
+        FALCON_TEST_ASSERT_EQ(ii, message);
+    }
+
+    FALCON_TEST_ASSERT(!ring.pop(1, message));
+    FALCON_TEST_ASSERT_EQ(0u, ring.size());
+}
+
+FALCON_TEST(ring_buffer_rounds_capacity_up_and_refuses_overflow)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(5);
+
+    for (uint32_t ii = 0; ii < 8; ++ii)
+    {
+        FALCON_TEST_ASSERT(ring.push(0, ii));
+    }
+    FALCON_TEST_ASSERT(!ring.push(0, 8));
+
+    uint32_t message = 0;
+    FALCON_TEST_ASSERT(ring.pop(1, message));
+    FALCON_TEST_ASSERT_EQ(0u, message);
+
+    /* the freed slot is reused */
+    FALCON_TEST_ASSERT(ring.push(0, 8));
+    FALCON_TEST_ASSERT(!ring.push(0, 9));
+}
+
+FALCON_TEST(ring_buffer_wraps_around)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(4);
+
+    /* keep the buffer partly full so that the head and tail cross the end of
+     *  the slot array at different times */
+    uint32_t next_push = 0;
+    uint32_t next_pop = 0;
+    uint32_t message = 0;
+
+    FALCON_TEST_ASSERT(ring.push(0, next_push++));
+    FALCON_TEST_ASSERT(ring.push(0, next_push++));
+
+    for (uint32_t ii = 0; ii < 1000; ++ii)
+    {
+        FALCON_TEST_ASSERT(ring.push(0, next_push++));
+        FALCON_TEST_ASSERT(ring.pop(1, message));
+        FALCON_TEST_ASSERT_EQ(next_pop++, message);
+    }
+
+    while (ring.pop(1, message))
+    {
+        FALCON_TEST_ASSERT_EQ(next_pop++, message);
+    }
+    FALCON_TEST_ASSERT_EQ(next_push, next_pop);
+}
+
+FALCON_TEST(ring_buffer_refuses_messages_from_the_current_timestep)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(8);
+    uint32_t message = 0;
+
+    FALCON_TEST_ASSERT(ring.push(5, 50));
+    FALCON_TEST_ASSERT(!ring.pop(5, message));
+    FALCON_TEST_ASSERT(!ring.pop(4, message));
+    FALCON_TEST_ASSERT_EQ(1u, ring.size());
+
+    FALCON_TEST_ASSERT(ring.pop(6, message));
+    FALCON_TEST_ASSERT_EQ(50u, message);
+
+    /* an older message is delivered, a newer one behind it is held back */
+    FALCON_TEST_ASSERT(ring.push(6, 60));
+    FALCON_TEST_ASSERT(ring.push(7, 70));
+    FALCON_TEST_ASSERT(ring.pop(7, message));
+    FALCON_TEST_ASSERT_EQ(60u, message);
+    FALCON_TEST_ASSERT(!ring.pop(7, message));
+}
+
+FALCON_TEST(ring_buffer_clear_discards_messages)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(8);
+    uint32_t message = 0;
+
+    FALCON_TEST_ASSERT(ring.push(0, 1));
+    FALCON_TEST_ASSERT(ring.push(0, 2));
+    ring.clear();
+
+    FALCON_TEST_ASSERT_EQ(0u, ring.size());
+    FALCON_TEST_ASSERT(!ring.pop(1, message));
+    FALCON_TEST_ASSERT(ring.push(1, 3));
+    FALCON_TEST_ASSERT(ring.pop(2, message));
+    FALCON_TEST_ASSERT_EQ(3u, message);
+}
+
+FALCON_TEST(ring_buffer_preserves_order_across_threads)
+{
+    falcon_simulation_environment_ring_buffer<uint32_t> ring(64);
+
+    std::thread producer([&ring]() {
+        for (uint32_t ii = 0; ii < NUM_THREADED_MESSAGES; ++ii)
+        {
+            while (!ring.push(0, ii))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    bool in_order = true;
+    uint32_t message = 0;
+    while (expected < NUM_THREADED_MESSAGES)
+    {
+        if (ring.pop(1, message))
+        {
+            in_order = in_order && (message == expected);
+            expected++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    FALCON_TEST_ASSERT(in_order);
+    FALCON_TEST_ASSERT_EQ(0u, ring.size());
+}
+
+FALCON_TEST(channel_visits_lanes_round_robin)
+{
+    falcon_simulation_environment_channel<uint32_t> channel(1, 8);
+
+    int32_t lane_a = channel.attach_producer();
+    int32_t lane_b = channel.attach_producer();
+    FALCON_TEST_ASSERT(channel.attach_consumer());
+    FALCON_TEST_ASSERT(!channel.attach_consumer());
+    FALCON_TEST_ASSERT_EQ(2u, channel.get_num_producers());
+
+    FALCON_TEST_ASSERT(channel.publish(lane_a, 0, 10));
+    FALCON_TEST_ASSERT(channel.publish(lane_a, 0, 11));
+    FALCON_TEST_ASSERT(channel.publish(lane_b, 0, 20));
+    FALCON_TEST_ASSERT(channel.publish(lane_b, 0, 21));
+    FALCON_TEST_ASSERT_EQ(4u, channel.get_queue_depth());
+
+    uint32_t message = 0;
+    FALCON_TEST_ASSERT(!channel.consume(0, message));
+
+    const uint32_t expected[] = { 10, 20, 11, 21 };
+    for (uint32_t value : expected)
+    {
+        FALCON_TEST_ASSERT(channel.consume(1, message));
+        FALCON_TEST_ASSERT_EQ(value, message);
+    }
+
+    FALCON_TEST_ASSERT(!channel.consume(1, message));
+}
+
+FALCON_TEST(channel_serializes_queued_messages)
+{
+    falcon_simulation_environment_channel<uint32_t> channel(1, 8);
+    int32_t lane_a = channel.attach_producer();
+    int32_t lane_b = channel.attach_producer();
+
+    FALCON_TEST_ASSERT(channel.publish(lane_a, 0, 10));
+    FALCON_TEST_ASSERT(channel.publish(lane_a, 1, 11));
+    FALCON_TEST_ASSERT(channel.publish(lane_b, 0, 20));
+
+    uint32_t message = 0;
+    FALCON_TEST_ASSERT(channel.consume(1, message));
+    FALCON_TEST_ASSERT_EQ(10u, message);
+
+    std::vector<uint8_t> buffer;
+    FALCON_TEST_ASSERT(channel.serialize(buffer));
+
+    falcon_simulation_environment_channel<uint32_t> restored(1, 8);
+    restored.attach_producer();
+    FALCON_TEST_ASSERT(!restored.deserialize(buffer));
+    restored.attach_producer();
+    FALCON_TEST_ASSERT(restored.deserialize(buffer));
+    FALCON_TEST_ASSERT_EQ(2u, restored.get_queue_depth());
+
+    /* timestep stamps and the round-robin position survive the round trip */
+    FALCON_TEST_ASSERT(restored.consume(1, message));
+    FALCON_TEST_ASSERT_EQ(20u, message);
+    FALCON_TEST_ASSERT(!restored.consume(1, message));
+    FALCON_TEST_ASSERT(restored.consume(2, message));
+    FALCON_TEST_ASSERT_EQ(11u, message);
+
+    buffer.pop_back();
+    FALCON_TEST_ASSERT(!restored.deserialize(buffer));
+}
+
+FALCON_TEST(channel_registry_rejects_mismatched_types)
+{
+    falcon_simulation_environment_channel_registry registry;
+
+    auto channel = registry.get_channel<uint32_t>(7, 4);
+    FALCON_TEST_ASSERT(channel != nullptr);
+    FALCON_TEST_ASSERT(registry.get_channel<uint32_t>(7, 4) == channel);
+    FALCON_TEST_ASSERT(registry.get_channel<double>(7, 4) == nullptr);
+    FALCON_TEST_ASSERT(registry.find_channel(7) != nullptr);
+    FALCON_TEST_ASSERT(registry.find_channel(8) == nullptr);
+}
@@ -0,0 +1,465 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+/******************************************************************************
+ *
+ * @file     checkpoint_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for checkpoints and resume.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers resuming an interrupted simulation from its checkpoint and ending
+ *  in the same state as an uninterrupted run, with and without channel
+ *  messages in flight, and rejecting damaged checkpoint files.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Use the shared test helpers.
+ * 19-Oct-2026  OrthogonalHawk  Resume with channel messages in flight.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string.h>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_manager.h"
+
+#include "simulation_test.h"
+#include "simulation_test_helpers.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t NUM_ACCUMULATORS = 4;
+static const uint32_t NUM_TIMESTEPS = 20;
+static const uint32_t CHECKPOINT_INTERVAL = 4;
+static const uint32_t NUM_TIMESTEPS_BEFORE_INTERRUPTION = 14;
+
+static const FalconComponentId CHANNEL_PRODUCER_ID = 0;
+static const FalconComponentId CHANNEL_CONSUMER_ID = 1;
+static const FalconChannelId CHECKPOINT_TEST_CHANNEL_ID = 0;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+/*
+ * @brief  Holds a value that depends on every timestep it has advanced, so
+ *          that a resume from the wrong state cannot end where it should
+ */
+class checkpoint_test_accumulator_component : public falcon_simulation_environment_component
+{
+public:
+
+    explicit checkpoint_test_accumulator_component(FalconComponentId id)
+      : m_value(id + 1)
+    {
+        set_component_id(id);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        m_value = m_value * 6364136223846793005ull + current_timestep + 1;
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return static_cast<int32_t>((m_value >> 33) % 1000);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM serialize_state(FalconStateBuffer &buffer) override
+    {
+        buffer.resize(sizeof(m_value));
+        memcpy(buffer.data(), &m_value, sizeof(m_value));
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM deserialize_state(const FalconStateBuffer &buffer) override
+    {
+        if (buffer.size() != sizeof(m_value))
+        {
+            return FALCON_COMPONENT_STATUS_ENUM::UNSUPPORTED_STATE_SERIALIZATION;
+        }
+
+        memcpy(&m_value, buffer.data(), sizeof(m_value));
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    uint64_t    m_value;
+};
+
+/*
+ * @brief  Publishes two messages every timestep, or consumes one and folds
+ *          it into a running hash, so that a growing backlog of messages is
+ *          always in flight at the timestep boundary
+ */
+class checkpoint_test_channel_component : public falcon_simulation_environment_component
+{
+public:
+
+    explicit checkpoint_test_channel_component(FalconComponentId id)
+      : m_received(0),
+        m_num_received(0)
+    {
+        set_component_id(id);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        if (get_component_id() == CHANNEL_PRODUCER_ID)
+        {
+            m_writer = open_output_channel<uint32_t>(CHECKPOINT_TEST_CHANNEL_ID);
+            return m_writer.is_valid() ? FALCON_COMPONENT_STATUS_ENUM::SUCCESS : FALCON_COMPONENT_STATUS_ENUM::INITIALIZATION_FAILED;
+        }
+
+        m_reader = open_input_channel<uint32_t>(CHECKPOINT_TEST_CHANNEL_ID);
+        return m_reader.is_valid() ? FALCON_COMPONENT_STATUS_ENUM::SUCCESS : FALCON_COMPONENT_STATUS_ENUM::INITIALIZATION_FAILED;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        if (m_writer.is_valid())
+        {
+            if (!m_writer.publish(current_timestep, 2 * current_timestep) ||
+                !m_writer.publish(current_timestep, 2 * current_timestep + 1))
+            {
+                return FALCON_COMPONENT_STATUS_ENUM::FAILURE;
+            }
+        }
+        else
+        {
+            uint32_t message = 0;
+            if (m_reader.consume(current_timestep, message))
+            {
+                m_received = m_received * 6364136223846793005ull + message + 1;
+                m_num_received++;
+            }
+        }
+
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return 0;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM serialize_state(FalconStateBuffer &buffer) override
+    {
+        buffer.resize(sizeof(m_received) + sizeof(m_num_received));
+        memcpy(buffer.data(), &m_received, sizeof(m_received));
+        memcpy(buffer.data() + sizeof(m_received), &m_num_received, sizeof(m_num_received));
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM deserialize_state(const FalconStateBuffer &buffer) override
+    {
+        if (buffer.size() != sizeof(m_received) + sizeof(m_num_received))
+        {
+            return FALCON_COMPONENT_STATUS_ENUM::UNSUPPORTED_STATE_SERIALIZATION;
+        }
+
+        memcpy(&m_received, buffer.data(), sizeof(m_received));
+        memcpy(&m_num_received, buffer.data() + sizeof(m_received), sizeof(m_num_received));
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    falcon_simulation_environment_channel_writer<uint32_t>    m_writer;
+    falcon_simulation_environment_channel_reader<uint32_t>    m_reader;
+    uint64_t                                                  m_received;
+    uint32_t                                                  m_num_received;
+};
+
+/*
+ * @brief  Runs the accumulators with the given options after the defaults
+ */
+class checkpoint_test_run
+{
+public:
+
+    explicit checkpoint_test_run(const std::vector<std::string> &options)
+      : checkpoint_test_run(options, true)
+    {
+        /* no action required at this time */
+    }
+
+    FALCON_MANAGER_STATUS_ENUM initialize(void)
+    {
+        return m_manager.initialize(static_cast<int>(m_argv.size()), m_argv.data());
+    }
+
+    falcon_simulation_environment_manager                                  m_manager;
+    std::vector<std::shared_ptr<checkpoint_test_accumulator_component>>    m_components;
+
+protected:
+
+    checkpoint_test_run(const std::vector<std::string> &options, bool add_accumulators)
+    {
+        m_args = { "checkpoint_test", "--duration", std::to_string(NUM_TIMESTEPS), "--threads", "2" };
+        m_args.insert(m_args.end(), options.begin(), options.end());
+        for (auto &arg : m_args)
+        {
+            m_argv.push_back(const_cast<char *>(arg.c_str()));
+        }
+
+        for (FalconComponentId id = 0; add_accumulators && id < NUM_ACCUMULATORS; ++id)
+        {
+            m_components.push_back(std::make_shared<checkpoint_test_accumulator_component>(id));
+            m_manager.add_component(m_components.back());
+        }
+    }
+
+private:
+
+    std::vector<std::string>    m_args;
+    std::vector<char *>         m_argv;
+};
+
+/*
+ * @brief  Runs a channel producer and consumer with the given options after
+ *          the defaults
+ */
+class checkpoint_test_channel_run : public checkpoint_test_run
+{
+public:
+
+    explicit checkpoint_test_channel_run(const std::vector<std::string> &options)
+      : checkpoint_test_run(options, false),
+        m_producer(std::make_shared<checkpoint_test_channel_component>(CHANNEL_PRODUCER_ID)),
+        m_consumer(std::make_shared<checkpoint_test_channel_component>(CHANNEL_CONSUMER_ID))
+    {
+        m_manager.add_component(m_producer);
+        m_manager.add_component(m_consumer);
+    }
+
+    std::shared_ptr<checkpoint_test_channel_component>    m_producer;
+    std::shared_ptr<checkpoint_test_channel_component>    m_consumer;
+};
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+/*
+ * @brief  Finds the file holding a record in the committed manifest
+ */
+static std::string find_record_file(const std::string &dir, const std::string &record)
+{
+    std::ifstream manifest(dir + "/checkpoint.manifest");
+    std::string line;
+    while (std::getline(manifest, line))
+    {
+        std::stringstream ss(line);
+        std::string key;
+        std::string name;
+        std::string file_name;
+        if ((ss >> key >> name >> file_name) && key == "record" && name == record)
+        {
+            return dir + "/" + file_name;
+        }
+    }
+
+    return "";
+}
+
+static std::string read_file(const std::string &path)
+{
+    std::ifstream input(path, std::ios::binary);
+    std::stringstream ss;
+    ss << input.rdbuf();
+    return ss.str();
+}
+
+static void write_file(const std::string &path, const std::string &contents)
+{
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output << contents;
+}
+
+static FALCON_MANAGER_STATUS_ENUM resume(const std::string &dir)
+{
+    checkpoint_test_run run({ "--checkpoint-dir", dir, "--resume", "1" });
+    return run.initialize();
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(checkpoint_resume_matches_uninterrupted_run)
+{
+    std::string dir = make_temp_dir("falcon_checkpoint_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+
+    checkpoint_test_run reference({});
+    FALCON_TEST_ASSERT(reference.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(reference.m_manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(reference.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    {
+        checkpoint_test_run interrupted({ "--checkpoint-dir", dir, "--checkpoint-interval", std::to_string(CHECKPOINT_INTERVAL) });
+        FALCON_TEST_ASSERT(interrupted.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        for (uint32_t ii = 0; ii < NUM_TIMESTEPS_BEFORE_INTERRUPTION; ++ii)
+        {
+            FALCON_TEST_ASSERT(interrupted.m_manager.step() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        }
+        FALCON_TEST_ASSERT(interrupted.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    }
+
+    checkpoint_test_run resumed({ "--checkpoint-dir", dir, "--resume", "1" });
+    FALCON_TEST_ASSERT(resumed.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    /* a checkpoint is skipped while the previous one is being written, so
+     *  the latest may be any multiple of the interval */
+    uint32_t resumed_timestep = resumed.m_manager.get_current_timestep();
+    FALCON_TEST_ASSERT(resumed_timestep > 0);
+    FALCON_TEST_ASSERT(resumed_timestep <= NUM_TIMESTEPS_BEFORE_INTERRUPTION);
+    FALCON_TEST_ASSERT_EQ(0u, resumed_timestep % CHECKPOINT_INTERVAL);
+
+    FALCON_TEST_ASSERT(resumed.m_manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(resumed.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    FALCON_TEST_ASSERT_EQ(NUM_TIMESTEPS, resumed.m_manager.get_current_timestep());
+    FALCON_TEST_ASSERT_EQ(reference.m_manager.get_cumulative_reward(), resumed.m_manager.get_cumulative_reward());
+    for (uint32_t ii = 0; ii < NUM_ACCUMULATORS; ++ii)
+    {
+        FALCON_TEST_ASSERT_EQ(reference.m_components[ii]->m_value, resumed.m_components[ii]->m_value);
+    }
+
+    remove_temp_dir(dir);
+}
+
+FALCON_TEST(checkpoint_rejects_damaged_records)
+{
+    std::string dir = make_temp_dir("falcon_checkpoint_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+
+    {
+        checkpoint_test_run run({ "--checkpoint-dir", dir, "--checkpoint-interval", std::to_string(CHECKPOINT_INTERVAL) });
+        FALCON_TEST_ASSERT(run.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        FALCON_TEST_ASSERT(run.m_manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        FALCON_TEST_ASSERT(run.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    }
+    FALCON_TEST_ASSERT(resume(dir) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    std::string record_path = find_record_file(dir, "component_0");
+    FALCON_TEST_ASSERT(!record_path.empty());
+    const std::string record = read_file(record_path);
+    FALCON_TEST_ASSERT_EQ(sizeof(uint64_t), record.size());
+
+    /* a flipped bit keeps the size but not the hash */
+    std::string corrupt = record;
+    corrupt[0] ^= 0x01;
+    write_file(record_path, corrupt);
+    FALCON_TEST_ASSERT(resume(dir) != FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    write_file(record_path, record.substr(0, record.size() - 1));
+    FALCON_TEST_ASSERT(resume(dir) != FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    write_file(record_path, record);
+    FALCON_TEST_ASSERT(resume(dir) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    /* a manifest cut short before its records lacks the timestep */
+    const std::string manifest_path = dir + "/checkpoint.manifest";
+    const std::string manifest = read_file(manifest_path);
+    write_file(manifest_path, manifest.substr(0, manifest.find('\n') + 1));
+    FALCON_TEST_ASSERT(resume(dir) != FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    remove_temp_dir(dir);
+}
+
+FALCON_TEST(checkpoint_resume_restores_messages_in_flight)
+{
+    std::string dir = make_temp_dir("falcon_checkpoint_test");
+    FALCON_TEST_ASSERT(!dir.empty());
+
+    checkpoint_test_channel_run reference({});
+    FALCON_TEST_ASSERT(reference.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(reference.m_manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(reference.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    /* the consumer takes one of the two messages published each timestep,
+     *  so every checkpoint is captured with a backlog queued */
+    FALCON_TEST_ASSERT_EQ(NUM_TIMESTEPS - 1, reference.m_consumer->m_num_received);
+
+    {
+        checkpoint_test_channel_run interrupted({ "--checkpoint-dir", dir, "--checkpoint-interval", std::to_string(CHECKPOINT_INTERVAL) });
+        FALCON_TEST_ASSERT(interrupted.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        for (uint32_t ii = 0; ii < NUM_TIMESTEPS_BEFORE_INTERRUPTION; ++ii)
+        {
+            FALCON_TEST_ASSERT(interrupted.m_manager.step() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+        }
+        FALCON_TEST_ASSERT(interrupted.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    }
+
+    checkpoint_test_channel_run resumed({ "--checkpoint-dir", dir, "--resume", "1" });
+    FALCON_TEST_ASSERT(resumed.initialize() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(resumed.m_manager.get_current_timestep() > 0);
+
+    FALCON_TEST_ASSERT(resumed.m_manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(resumed.m_manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    FALCON_TEST_ASSERT_EQ(NUM_TIMESTEPS, resumed.m_manager.get_current_timestep());
+    FALCON_TEST_ASSERT_EQ(reference.m_consumer->m_num_received, resumed.m_consumer->m_num_received);
+    FALCON_TEST_ASSERT_EQ(reference.m_consumer->m_received, resumed.m_consumer->m_received);
+
+    remove_temp_dir(dir);
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     double_buffer_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for double-buffered component state.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers the double buffer itself and, through the manager, that readers of
+ *  a previous timestep dependency see the state published at the end of the
+ *  previous timestep while its owner advances concurrently, and that only
+ *  components declaring double-buffered state are published, including
+ *  those whose publish hook chains to the default implementation.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Components declare double-buffered state.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <atomic>
+#include <vector>
+
+#include "common/falcon_simulation_environment_double_buffer.h"
+#include "common/falcon_simulation_environment_manager.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t NUM_RING_COMPONENTS = 8;
+static const char *RING_ARGS[] = { "double_buffer_test", "--duration", "50", "--threads", "4" };
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+/*
+ * @brief  Writes timestep + 1 each timestep and checks that the previous
+ *          component in the ring published timestep during the last one
+ */
+class double_buffer_test_ring_component : public falcon_simulation_environment_component
+{
+public:
+
+    explicit double_buffer_test_ring_component(FalconComponentId id)
+      : m_value(0),
+        m_num_publications(0),
+        m_num_stale_reads(0)
+    {
+        set_component_id(id);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        FalconComponentIdList previous_ids = { (get_component_id() + NUM_RING_COMPONENTS - 1) % NUM_RING_COMPONENTS };
+        return set_previous_timestep_dependencies(previous_ids);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        auto previous = std::static_pointer_cast<double_buffer_test_ring_component>(dependencies.front());
+        if (previous->m_value.previous() != current_timestep)
+        {
+            m_num_stale_reads++;
+        }
+
+        m_value.current() = current_timestep + 1;
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    bool uses_double_buffered_state(void) const override
+    {
+        return true;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM publish_timestep_state(void) override
+    {
+        m_value.swap();
+        m_num_publications++;
+        return falcon_simulation_environment_component::publish_timestep_state();
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return 0;
+    }
+
+    falcon_simulation_environment_double_buffer<uint32_t>    m_value;
+    uint32_t                                                 m_num_publications;
+    std::atomic<uint32_t>                                    m_num_stale_reads;
+};
+
+/*
+ * @brief  Holds no double-buffered state; counts the publications it must
+ *          never receive
+ */
+class double_buffer_test_stateless_component : public falcon_simulation_environment_component
+{
+public:
+
+    explicit double_buffer_test_stateless_component(FalconComponentId id)
+      : m_num_publications(0)
+    {
+        set_component_id(id);
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM initialize(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t &current_timestep, FalconComponentList dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM publish_timestep_state(void) override
+    {
+        m_num_publications++;
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    FALCON_COMPONENT_STATUS_ENUM shutdown(FalconComponentList &dependencies) override
+    {
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void) override
+    {
+        return 0;
+    }
+
+    std::atomic<uint32_t>    m_num_publications;
+};
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(double_buffer_swaps_front_and_back)
+{
+    falcon_simulation_environment_double_buffer<uint32_t> buffer(7);
+    FALCON_TEST_ASSERT_EQ(7u, buffer.previous());
+    FALCON_TEST_ASSERT_EQ(7u, buffer.current());
+
+    buffer.current() = 8;
+    FALCON_TEST_ASSERT_EQ(7u, buffer.previous());
+
+    buffer.swap();
+    FALCON_TEST_ASSERT_EQ(8u, buffer.previous());
+    FALCON_TEST_ASSERT_EQ(7u, buffer.current());
+
+    buffer.current() = 9;
+    buffer.swap_and_retain();
+    FALCON_TEST_ASSERT_EQ(9u, buffer.previous());
+    FALCON_TEST_ASSERT_EQ(9u, buffer.current());
+}
+
+FALCON_TEST(previous_timestep_readers_see_published_state)
+{
+    falcon_simulation_environment_manager manager;
+    std::vector<std::shared_ptr<double_buffer_test_ring_component>> ring;
+
+    for (uint32_t ii = 0; ii < NUM_RING_COMPONENTS; ++ii)
+    {
+        ring.push_back(std::make_shared<double_buffer_test_ring_component>(ii));
+        FALCON_TEST_ASSERT(manager.add_component(ring.back()) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    }
+
+    auto stateless = std::make_shared<double_buffer_test_stateless_component>(NUM_RING_COMPONENTS);
+    FALCON_TEST_ASSERT(manager.add_component(stateless) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    FALCON_TEST_ASSERT(manager.initialize(5, const_cast<char **>(RING_ARGS)) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    for (auto &component : ring)
+    {
+        FALCON_TEST_ASSERT_EQ(0u, component->m_num_stale_reads.load());
+        FALCON_TEST_ASSERT_EQ(50u, component->m_num_publications);
+        FALCON_TEST_ASSERT_EQ(50u, component->m_value.previous());
+    }
+
+    FALCON_TEST_ASSERT_EQ(0u, stateless->m_num_publications.load());
+}
@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+/******************************************************************************
+ *
+ * @file     load_balancer_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the adaptive schedule load balancer.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers longest-processing-time assignment, co-location of components that
+ *  share dependencies and the makespan estimates used to choose a schedule.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <vector>
+
+#include "common/falcon_simulation_environment_load_balancer.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+static std::vector<falcon_load_balancer_task> make_tasks(const std::vector<double> &costs)
+{
+    std::vector<falcon_load_balancer_task> ret;
+    for (auto cost : costs)
+    {
+        ret.push_back({ cost, FalconComponentIdList() });
+    }
+
+    return ret;
+}
+
+FALCON_TEST(load_balancer_assigns_longest_first)
+{
+    falcon_simulation_environment_load_balancer balancer;
+    FalconThreadTaskLists assignment;
+
+    const std::vector<double> costs = { 7, 5, 4, 3, 3, 2 };
+    balancer.begin_plan(2);
+    double makespan = balancer.plan_wave(make_tasks(costs), assignment);
+
+    /* the optimum for these costs; dealing them out in order gives 14 */
+    FALCON_TEST_ASSERT_EQ(12.0, makespan);
+    FALCON_TEST_ASSERT_EQ(2u, assignment.size());
+    FALCON_TEST_ASSERT_EQ(12.0, falcon_simulation_environment_load_balancer::estimate_assigned_makespan(costs, assignment));
+    FALCON_TEST_ASSERT_EQ(6u, assignment[0].size() + assignment[1].size());
+
+    /* each thread runs its most expensive task first */
+    FALCON_TEST_ASSERT_EQ(0u, assignment[0].front());
+    FALCON_TEST_ASSERT_EQ(1u, assignment[1].front());
+}
+
+FALCON_TEST(load_balancer_isolates_dominant_task)
+{
+    falcon_simulation_environment_load_balancer balancer;
+    FalconThreadTaskLists assignment;
+
+    const std::vector<double> costs = { 1, 1, 10, 1 };
+    balancer.begin_plan(2);
+    double makespan = balancer.plan_wave(make_tasks(costs), assignment);
+
+    FALCON_TEST_ASSERT_EQ(10.0, makespan);
+    FALCON_TEST_ASSERT_EQ(1u, assignment[0].size());
+    FALCON_TEST_ASSERT_EQ(2u, assignment[0].front());
+    FALCON_TEST_ASSERT_EQ(3u, assignment[1].size());
+
+    /* claiming tasks in order starts the dominant one late */
+    FALCON_TEST_ASSERT_EQ(11.0, falcon_simulation_environment_load_balancer::estimate_dynamic_makespan(costs, 2));
+}
+
+FALCON_TEST(load_balancer_colocates_dependents)
+{
+    falcon_simulation_environment_load_balancer balancer;
+    FalconThreadTaskLists assignment;
+
+    balancer.begin_plan(2);
+    std::vector<falcon_load_balancer_task> sources = {
+        { 1.0, FalconComponentIdList{ 0 } },
+        { 1.0, FalconComponentIdList{ 1 } },
+    };
+    balancer.plan_wave(sources, assignment);
+    FALCON_TEST_ASSERT_EQ(0u, assignment[0].front());
+    FALCON_TEST_ASSERT_EQ(1u, assignment[1].front());
+
+    /* each dependent follows its source to the thread that produced it */
+    std::vector<falcon_load_balancer_task> dependents = {
+        { 1.0, FalconComponentIdList{ 10, 1 } },
+        { 1.0, FalconComponentIdList{ 11, 0 } },
+    };
+    balancer.plan_wave(dependents, assignment);
+    FALCON_TEST_ASSERT_EQ(1u, assignment[0].size());
+    FALCON_TEST_ASSERT_EQ(1u, assignment[0].front());
+    FALCON_TEST_ASSERT_EQ(1u, assignment[1].size());
+    FALCON_TEST_ASSERT_EQ(0u, assignment[1].front());
+}
@@ -0,0 +1,265 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     metrics_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the metrics registry and its exporter.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers merging per-thread values, gauges that are both set and added to,
+ *  sampled gauges, registration past capacity, the Prometheus rendering and
+ *  the HTTP endpoint and log summary of the exporter.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+#include "common/falcon_simulation_environment_metrics.h"
+#include "common/falcon_simulation_environment_metrics_exporter.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t NUM_WRITER_THREADS = 4;
+static const uint32_t NUM_WRITER_ADDS = 10000;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+/*
+ * @brief  Sends one HTTP request to a Unix domain socket and returns the
+ *          whole response, or an empty string if the connection failed
+ */
+static std::string http_request(const std::string &socket_path, const std::string &request)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return std::string();
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    std::string response;
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0 &&
+        send(fd, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size()))
+    {
+        char buffer[1024];
+        ssize_t num_read;
+        while ((num_read = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        {
+            response.append(buffer, num_read);
+        }
+    }
+
+    close(fd);
+    return response;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(metrics_merge_values_across_threads)
+{
+    falcon_simulation_environment_metrics metrics;
+    FalconMetricId counter = metrics.register_counter("test_adds_total", "", "Adds.");
+    FalconMetricId gauge = metrics.register_gauge("test_level", "", "Level.");
+
+    std::vector<std::thread> writers;
+    for (uint32_t ii = 0; ii < NUM_WRITER_THREADS; ++ii)
+    {
+        writers.emplace_back([&metrics, counter]() {
+            for (uint32_t jj = 0; jj < NUM_WRITER_ADDS; ++jj)
+            {
+                metrics.add(counter, 1);
+            }
+        });
+    }
+
+    for (auto &writer : writers)
+    {
+        writer.join();
+    }
+
+    /* a gauge reads as its last set value plus every add */
+    metrics.set(gauge, 2.5);
+    metrics.add(gauge, 3);
+    metrics.add(gauge, -1);
+
+    FALCON_TEST_ASSERT_EQ(static_cast<double>(NUM_WRITER_THREADS * NUM_WRITER_ADDS), metrics.read(counter));
+    FALCON_TEST_ASSERT_EQ(4.5, metrics.read(gauge));
+    FALCON_TEST_ASSERT(std::isnan(metrics.read(gauge + 1)));
+}
+
+FALCON_TEST(metrics_registries_do_not_share_thread_values)
+{
+    /* one thread alternating between registries must keep their values apart */
+    falcon_simulation_environment_metrics first;
+    falcon_simulation_environment_metrics second;
+    FalconMetricId first_id = first.register_counter("test_total", "", "Test.");
+    FalconMetricId second_id = second.register_counter("test_total", "", "Test.");
+
+    for (uint32_t ii = 0; ii < 3; ++ii)
+    {
+        first.add(first_id, 1);
+        second.add(second_id, 10);
+    }
+
+    FALCON_TEST_ASSERT_EQ(3.0, first.read(first_id));
+    FALCON_TEST_ASSERT_EQ(30.0, second.read(second_id));
+}
+
+FALCON_TEST(metrics_registration_past_capacity_is_rejected)
+{
+    falcon_simulation_environment_metrics metrics(2);
+    FalconMetricId first = metrics.register_counter("test_first_total", "", "First.");
+    FalconMetricId second = metrics.register_gauge("test_second", "", "Second.");
+    FalconMetricId overflow = metrics.register_counter("test_overflow_total", "", "Overflow.");
+
+    FALCON_TEST_ASSERT_EQ(0u, first);
+    FALCON_TEST_ASSERT_EQ(1u, second);
+    FALCON_TEST_ASSERT_EQ(FALCON_METRICS_INVALID_ID, overflow);
+
+    /* updates through the invalid id are discarded, not written out of bounds */
+    metrics.add(overflow, 1);
+    metrics.set(overflow, 1.0);
+    metrics.add(first, 1);
+
+    FALCON_TEST_ASSERT_EQ(1.0, metrics.read(first));
+    FALCON_TEST_ASSERT_EQ(0.0, metrics.read(second));
+    FALCON_TEST_ASSERT(metrics.render_prometheus().find("test_overflow_total") == std::string::npos);
+}
+
+FALCON_TEST(metrics_render_prometheus_families)
+{
+    falcon_simulation_environment_metrics metrics;
+    FalconMetricId zero = metrics.register_counter("test_events_total", "component=\"0\"", "Events.");
+    metrics.register_gauge("test_depth", "", "Depth.");
+    FalconMetricId one = metrics.register_counter("test_events_total", "component=\"1\"", "Events.");
+    metrics.register_sampled_gauge("test_sampled", "", "Sampled.", []{ return 0.25; });
+    metrics.register_sampled_gauge("test_missing", "", "Missing.", []{ return NAN; });
+
+    metrics.add(zero, 2);
+    metrics.add(one, 5);
+
+    const std::string expected =
+        "# HELP test_events_total Events.\n"
+        "# TYPE test_events_total counter\n"
+        "test_events_total{component=\"0\"} 2\n"
+        "test_events_total{component=\"1\"} 5\n"
+        "# HELP test_depth Depth.\n"
+        "# TYPE test_depth gauge\n"
+        "test_depth 0\n"
+        "# HELP test_sampled Sampled.\n"
+        "# TYPE test_sampled gauge\n"
+        "test_sampled 0.25\n"
+        "# HELP test_missing Missing.\n"
+        "# TYPE test_missing gauge\n"
+        "test_missing NaN\n";
+    FALCON_TEST_ASSERT_EQ(expected, metrics.render_prometheus());
+}
+
+FALCON_TEST(metrics_exporter_serves_registry_and_summary)
+{
+    char dir[] = "/tmp/falcon_metrics_test_XXXXXX";
+    FALCON_TEST_ASSERT(mkdtemp(dir) != nullptr);
+    std::string socket_path = std::string(dir) + "/metrics.sock";
+
+    auto metrics = std::make_shared<falcon_simulation_environment_metrics>();
+    FalconMetricId id = metrics->register_counter("test_requests_total", "", "Requests.");
+    metrics->add(id, 7);
+
+    std::atomic<uint32_t> num_summaries(0);
+    falcon_simulation_environment_metrics_exporter exporter;
+    FALCON_TEST_ASSERT(exporter.initialize(metrics, socket_path, 1, [&num_summaries]() {
+        num_summaries++;
+        return std::string("test summary");
+    }));
+
+    std::string response = http_request(socket_path, "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    FALCON_TEST_ASSERT(response.compare(0, 15, "HTTP/1.0 200 OK") == 0);
+    FALCON_TEST_ASSERT(response.find("\r\n\r\n# HELP test_requests_total Requests.\n") != std::string::npos);
+    FALCON_TEST_ASSERT(response.find("\ntest_requests_total 7\n") != std::string::npos);
+
+    response = http_request(socket_path, "GET /other HTTP/1.1\r\n\r\n");
+    FALCON_TEST_ASSERT(response.compare(0, 22, "HTTP/1.0 404 Not Found") == 0);
+
+    /* the summary is only evaluated when info records are logged */
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >= boost::log::trivial::info);
+    for (uint32_t ii = 0; ii < 300 && num_summaries == 0; ++ii)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    boost::log::core::get()->set_filter(boost::log::trivial::severity > boost::log::trivial::error);
+    FALCON_TEST_ASSERT(num_summaries > 0);
+
+    exporter.shutdown();
+    FALCON_TEST_ASSERT(access(socket_path.c_str(), F_OK) != 0);
+    rmdir(dir);
+}
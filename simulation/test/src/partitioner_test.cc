@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     partitioner_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the component graph partitioner.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers cutting the graph at its weakest edge, balancing by component
+ *  weight and deterministic assignment.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include "common/falcon_simulation_environment_partitioner.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(partitioner_cuts_between_clusters)
+{
+    falcon_simulation_environment_partitioner partitioner;
+
+    /* two fully connected clusters of four joined by a single light edge,
+     *  with the ids interleaved so that id order does not give the answer */
+    const FalconComponentId cluster_a[] = { 0, 2, 4, 6 };
+    const FalconComponentId cluster_b[] = { 1, 3, 5, 7 };
+    for (FalconComponentId id = 0; id < 8; ++id)
+    {
+        partitioner.add_component(id);
+    }
+
+    for (uint32_t ii = 0; ii < 4; ++ii)
+    {
+        for (uint32_t jj = ii + 1; jj < 4; ++jj)
+        {
+            partitioner.add_edge(cluster_a[ii], cluster_a[jj], 10);
+            partitioner.add_edge(cluster_b[ii], cluster_b[jj], 10);
+        }
+    }
+    partitioner.add_edge(6, 7, 1);
+
+    FalconComponentRankMap parts;
+    FALCON_TEST_ASSERT(partitioner.partition(2, parts));
+    FALCON_TEST_ASSERT_EQ(8u, parts.size());
+    FALCON_TEST_ASSERT_EQ(1u, partitioner.get_cut_weight(parts));
+    FALCON_TEST_ASSERT_EQ(4u, partitioner.get_part_weight(parts, 0));
+    FALCON_TEST_ASSERT_EQ(4u, partitioner.get_part_weight(parts, 1));
+
+    FalconComponentRankMap repeated;
+    FALCON_TEST_ASSERT(partitioner.partition(2, repeated));
+    FALCON_TEST_ASSERT(parts == repeated);
+}
+
+FALCON_TEST(partitioner_balances_by_weight)
+{
+    falcon_simulation_environment_partitioner partitioner;
+
+    /* a chain whose first component costs as much as the other ten together */
+    partitioner.add_component(0, 10);
+    for (FalconComponentId id = 1; id <= 10; ++id)
+    {
+        partitioner.add_component(id, 1);
+        partitioner.add_edge(id - 1, id, 1);
+    }
+
+    FalconComponentRankMap parts;
+    FALCON_TEST_ASSERT(partitioner.partition(2, parts));
+    FALCON_TEST_ASSERT_EQ(10u, partitioner.get_part_weight(parts, 0));
+    FALCON_TEST_ASSERT_EQ(10u, partitioner.get_part_weight(parts, 1));
+    FALCON_TEST_ASSERT_EQ(1u, partitioner.get_cut_weight(parts));
+}
+
+FALCON_TEST(partitioner_handles_more_parts_than_components)
+{
+    falcon_simulation_environment_partitioner partitioner;
+    partitioner.add_component(0);
+    partitioner.add_component(1);
+
+    FalconComponentRankMap parts;
+    FALCON_TEST_ASSERT(partitioner.partition(4, parts));
+    FALCON_TEST_ASSERT_EQ(2u, parts.size());
+    FALCON_TEST_ASSERT(!partitioner.partition(0, parts));
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+/******************************************************************************
+ *
+ * @file     simulation_test_helpers.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Helpers shared by the FALCON simulation unit tests.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the scratch directory and sweep parsing helpers declared in
+ *  simulation_test_helpers.h.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <dirent.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "simulation_test_helpers.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+std::string make_temp_dir(const std::string &name)
+{
+    std::string pattern = "/tmp/" + name + "_XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+
+    return (mkdtemp(path.data()) != nullptr) ? std::string(path.data()) : "";
+}
+
+void remove_temp_dir(const std::string &dir)
+{
+    DIR *handle = opendir(dir.c_str());
+    if (handle != nullptr)
+    {
+        struct dirent *entry;
+        while ((entry = readdir(handle)) != nullptr)
+        {
+            std::string name = entry->d_name;
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+
+            /* lstat() so that a link to a directory is removed, not followed */
+            std::string path = dir + "/" + name;
+            struct stat info;
+            if (lstat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+            {
+                remove_temp_dir(path);
+            }
+            else
+            {
+                unlink(path.c_str());
+            }
+        }
+        closedir(handle);
+    }
+
+    rmdir(dir.c_str());
+}
+
+bool parse_sweep(const std::string &text, falcon_simulation_environment_sweep_spec &spec)
+{
+    std::stringstream input(text);
+    return spec.parse(input);
+}
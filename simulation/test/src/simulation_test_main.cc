@@ -29,22 +29,18 @@
  * @author   OrthogonalHawk
  * @date     02-Feb-2018
  *
- * @brief    Basic test file for the FALCON simulation module.
+ * @brief    Unit test runner for the FALCON simulation module.
  *
  * @section  DESCRIPTION
  *
- * As the first FALCON application, the simulation module is used to test a
- *  number of different features, including application and library compiling.
- *  This application will eventually serve as the basis for a series of unit
- *  test to verify simulation environment functionality, but for now it is a
- *  catch-all for testing purposes.
- *
- * @todo     Update description once application is used for its originally
- *            intended purpose.
+ * Runs the unit tests of the FALCON simulation module. Every test registered
+ *  with FALCON_TEST() runs unless a name filter is given as the only argument;
+ *  the exit status is non-zero if any test fails.
  *
  * @section  HISTORY
  *
  * 02-Feb-2018  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Replaced the placeholder with the unit test runner.
  *
  *****************************************************************************/
 
@@ -58,6 +54,8 @@
 
 #include "falcon_log.h"
 
+#include "simulation_test.h"
+
 /******************************************************************************
  *                                 CONSTANTS
  *****************************************************************************/
@@ -74,15 +72,15 @@
  *                            CLASS IMPLEMENTATION
  *****************************************************************************/
 
-#include <stdio.h>
-
 int main(int argc, char **argv)
 {
-	falcon_log logger;
-	logger.initialize();
+    falcon_log logger;
+    logger.initialize();
+
+    /* expected failures are logged as errors by the code under test */
+    boost::log::core::get()->set_filter(boost::log::trivial::severity > boost::log::trivial::error);
 
-	BOOST_LOG_TRIVIAL(info) << "An informational severity message";
+    std::string filter = (argc > 1) ? argv[1] : "";
 
-    printf("Hello World\n");
-	return 0;
+    return (falcon_simulation_test_registry::get_instance().run_tests(filter) == 0) ? 0 : 1;
 }
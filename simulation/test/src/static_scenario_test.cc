@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     static_scenario_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for compile-time static scenarios.
+ *
+ * @section  DESCRIPTION
+ *
+ * Checks the constexpr topological sort with static_assert, and instantiates
+ *  a small DAG declared out of order to check the initialize, advance and
+ *  shutdown order both directly and through the static subgraph adapter.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/falcon_simulation_environment_manager.h"
+#include "common/falcon_simulation_environment_static_scenario.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const char *SUBGRAPH_ARGS[] = { "static_scenario_test", "--duration", "3", "--threads", "1" };
+
+/* a diamond, 3 -> {1, 2} -> 0, declared so that id order is not a valid schedule */
+static constexpr falcon_static_graph<4, 4> DIAMOND_GRAPH = { { 1, 2, 0, 0 }, { 3, 3, 1, 2 } };
+static constexpr falcon_static_graph<2, 2> CYCLIC_GRAPH = { { 0, 1 }, { 1, 0 } };
+static constexpr falcon_static_graph<3, 0> UNCONSTRAINED_GRAPH = { { 0 }, { 0 } };
+
+static_assert(falcon_static_topological_sort(DIAMOND_GRAPH).valid, "diamond must be schedulable");
+static_assert(falcon_static_topological_sort(DIAMOND_GRAPH).order[0] == 3, "diamond root must come first");
+static_assert(falcon_static_topological_sort(DIAMOND_GRAPH).order[1] == 1, "ties keep declaration order");
+static_assert(falcon_static_topological_sort(DIAMOND_GRAPH).order[2] == 2, "ties keep declaration order");
+static_assert(falcon_static_topological_sort(DIAMOND_GRAPH).order[3] == 0, "diamond sink must come last");
+static_assert(!falcon_static_topological_sort(CYCLIC_GRAPH).valid, "cycles must be rejected");
+static_assert(falcon_static_topological_sort(UNCONSTRAINED_GRAPH).order[2] == 2, "no edges keeps declaration order");
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              CLASS DECLARATION
+ *****************************************************************************/
+
+static std::vector<std::string> static_scenario_test_log;
+
+/*
+ * @brief  Appends "<phase>:<Name>" to the log for every call
+ */
+template <char Name>
+class static_scenario_test_component final
+{
+public:
+
+    template <typename Scenario>
+    FALCON_COMPONENT_STATUS_ENUM initialize(Scenario &scenario)
+    {
+        record("init");
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    template <typename Scenario>
+    FALCON_COMPONENT_STATUS_ENUM advance_timestep(uint32_t current_timestep, Scenario &scenario)
+    {
+        record("advance");
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    template <typename Scenario>
+    FALCON_COMPONENT_STATUS_ENUM shutdown(Scenario &scenario)
+    {
+        record("shutdown");
+        return FALCON_COMPONENT_STATUS_ENUM::SUCCESS;
+    }
+
+    int32_t get_timestep_reward(void)
+    {
+        return Name - 'a' + 1;
+    }
+
+private:
+
+    void record(const char *phase)
+    {
+        static_scenario_test_log.push_back(std::string(phase) + ":" + Name);
+    }
+};
+
+typedef static_scenario_test_component<'a'> static_scenario_test_sensor;
+typedef static_scenario_test_component<'b'> static_scenario_test_tracker;
+typedef static_scenario_test_component<'c'> static_scenario_test_controller;
+
+/* declared in reverse dependency order */
+typedef falcon_simulation_environment_static_scenario<
+    falcon_static_component_list<static_scenario_test_controller,
+                                 static_scenario_test_tracker,
+                                 static_scenario_test_sensor>,
+    falcon_static_dependency_list<
+        falcon_static_dependency<static_scenario_test_tracker, static_scenario_test_sensor>,
+        falcon_static_dependency<static_scenario_test_controller, static_scenario_test_tracker>>> static_scenario_test_pipeline;
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(static_scenario_runs_in_dependency_order)
+{
+    static_scenario_test_log.clear();
+
+    static_scenario_test_pipeline pipeline;
+    FALCON_TEST_ASSERT_EQ(3u, static_scenario_test_pipeline::NUM_COMPONENTS);
+    FALCON_TEST_ASSERT(pipeline.initialize() == FALCON_COMPONENT_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(pipeline.advance_timestep(0) == FALCON_COMPONENT_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT_EQ(6, pipeline.get_timestep_reward());
+    FALCON_TEST_ASSERT(pipeline.shutdown() == FALCON_COMPONENT_STATUS_ENUM::SUCCESS);
+
+    const std::vector<std::string> expected = {
+        "init:a", "init:b", "init:c",
+        "advance:a", "advance:b", "advance:c",
+        "shutdown:c", "shutdown:b", "shutdown:a" };
+    FALCON_TEST_ASSERT(static_scenario_test_log == expected);
+}
+
+FALCON_TEST(static_subgraph_runs_under_the_manager)
+{
+    static_scenario_test_log.clear();
+
+    falcon_simulation_environment_manager manager;
+    auto subgraph = std::make_shared<falcon_simulation_environment_static_subgraph<static_scenario_test_pipeline>>(0);
+    FALCON_TEST_ASSERT(manager.add_component(subgraph) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(manager.initialize(5, const_cast<char **>(SUBGRAPH_ARGS)) == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(manager.run_simulation() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+    FALCON_TEST_ASSERT(manager.shutdown() == FALCON_MANAGER_STATUS_ENUM::SUCCESS);
+
+    FALCON_TEST_ASSERT_EQ(18, manager.get_cumulative_reward());
+    FALCON_TEST_ASSERT(subgraph->get_component_state() == FALCON_COMPONENT_STATE_ENUM::SHUTDOWN_COMPLETE);
+
+    FALCON_TEST_ASSERT_EQ(15u, static_scenario_test_log.size());
+    FALCON_TEST_ASSERT_EQ(std::string("init:a"), static_scenario_test_log.front());
+    FALCON_TEST_ASSERT_EQ(std::string("shutdown:c"), static_scenario_test_log[12]);
+    FALCON_TEST_ASSERT_EQ(std::string("shutdown:a"), static_scenario_test_log.back());
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     sweep_spec_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the parameter sweep specification parser.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers expansion order, seed ranges at the top of the 64-bit range, the
+ *  bound on the number of trials, malformed input and the fingerprint.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Use the shared test helpers.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string>
+
+#include "common/falcon_simulation_environment_sweep_spec.h"
+
+#include "simulation_test.h"
+#include "simulation_test_helpers.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(sweep_spec_expands_scenario_major)
+{
+    falcon_simulation_environment_sweep_spec spec;
+    FALCON_TEST_ASSERT(parse_sweep("# comment line\n"
+                                   "scenario = alpha, beta   # two scenarios\n"
+                                   "duration = 60\n"
+                                   "seeds = 7, 10-11\n"
+                                   "param.speed = 1.0, 2.0\n", spec));
+
+    const FalconSweepTrialList &trials = spec.get_trials();
+    FALCON_TEST_ASSERT_EQ(12u, trials.size());
+
+    for (size_t ii = 0; ii < trials.size(); ++ii)
+    {
+        FALCON_TEST_ASSERT_EQ(static_cast<FalconTrialId>(ii), trials[ii].trial_id);
+        FALCON_TEST_ASSERT_EQ(60u, trials[ii].duration_in_secs);
+        FALCON_TEST_ASSERT_EQ(std::string(ii < 6 ? "alpha" : "beta"), trials[ii].scenario_name);
+    }
+
+    FALCON_TEST_ASSERT_EQ(std::string("speed=1.0"),
+                          falcon_simulation_environment_sweep_spec::format_parameters(trials[0].parameters));
+    FALCON_TEST_ASSERT_EQ(std::string("-"),
+                          falcon_simulation_environment_sweep_spec::format_parameters(FalconTrialParameters()));
+}
+
+FALCON_TEST(sweep_spec_counts_seed_ranges_at_the_top_of_the_range)
+{
+    falcon_simulation_environment_sweep_spec spec;
+    FALCON_TEST_ASSERT(parse_sweep("scenario = alpha\n"
+                                   "duration = 1\n"
+                                   "seeds = 18446744073709551613-18446744073709551615\n", spec));
+
+    const FalconSweepTrialList &trials = spec.get_trials();
+    FALCON_TEST_ASSERT_EQ(3u, trials.size());
+    FALCON_TEST_ASSERT_EQ(UINT64_MAX - 2, trials[0].seed);
+    FALCON_TEST_ASSERT_EQ(UINT64_MAX, trials[2].seed);
+}
+
+FALCON_TEST(sweep_spec_bounds_the_number_of_trials)
+{
+    falcon_simulation_environment_sweep_spec spec;
+
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = 0-18446744073709551615\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = 1-600000, 2000000-2600000\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha, beta\nduration = 1\nseeds = 1-600000\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = 1-1001\n"
+                                    "param.a = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10\n"
+                                    "param.b = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10\n"
+                                    "param.c = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10\n", spec));
+
+    FALCON_TEST_ASSERT(parse_sweep("scenario = alpha\nduration = 1\nseeds = 1-1000000\n", spec));
+    FALCON_TEST_ASSERT_EQ(static_cast<size_t>(FALCON_SWEEP_MAX_TRIALS), spec.get_trials().size());
+}
+
+FALCON_TEST(sweep_spec_rejects_malformed_input)
+{
+    falcon_simulation_environment_sweep_spec spec;
+
+    FALCON_TEST_ASSERT(!parse_sweep("duration = 1\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 0\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = 5-4\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = -4\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nseeds = 4x\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1, 2\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nspeed = 2\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario = alpha\nduration = 1\nparam. = 2\n", spec));
+    FALCON_TEST_ASSERT(!parse_sweep("scenario alpha\nduration = 1\n", spec));
+
+    /* without seeds every trial uses seed 0 */
+    FALCON_TEST_ASSERT(parse_sweep("scenario = alpha\nduration = 1\n", spec));
+    FALCON_TEST_ASSERT_EQ(1u, spec.get_trials().size());
+    FALCON_TEST_ASSERT_EQ(0u, spec.get_trials()[0].seed);
+}
+
+FALCON_TEST(sweep_spec_fingerprint_identifies_the_trial_list)
+{
+    falcon_simulation_environment_sweep_spec spec_a;
+    falcon_simulation_environment_sweep_spec spec_b;
+    falcon_simulation_environment_sweep_spec spec_c;
+
+    /* formatting differences that expand to the same trials do not matter */
+    FALCON_TEST_ASSERT(parse_sweep("scenario = alpha\nduration = 1\nseeds = 1-3\n", spec_a));
+    FALCON_TEST_ASSERT(parse_sweep("# same sweep\nscenario=alpha\nduration = 1\nseeds = 1, 2, 3\n", spec_b));
+    FALCON_TEST_ASSERT(parse_sweep("scenario = alpha\nduration = 1\nseeds = 1-4\n", spec_c));
+
+    FALCON_TEST_ASSERT_EQ(spec_a.get_fingerprint(), spec_b.get_fingerprint());
+    FALCON_TEST_ASSERT(spec_a.get_fingerprint() != spec_c.get_fingerprint());
+}
@@ -0,0 +1,248 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     transport_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the TCP transport and its collective operations.
+ *
+ * @section  DESCRIPTION
+ *
+ * Runs two ranks over 127.0.0.1, one per thread, and covers concurrent
+ *  exchange of large and empty buffers, all_reduce_sum() and the wire format
+ *  of the hello message and frame headers.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <thread>
+
+#include "common/falcon_simulation_environment_tcp_transport.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const char *LOOPBACK_HOST = "127.0.0.1";
+
+/* large enough to fill the socket buffers in both directions at once */
+static const size_t LARGE_BUFFER_SIZE = 8 * 1024 * 1024;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              HELPER FUNCTIONS
+ *****************************************************************************/
+
+/* distinct per test and per process so that concurrent runs do not collide */
+static uint16_t get_test_base_port(uint32_t test_idx)
+{
+    return static_cast<uint16_t>(20000 + (getpid() % 1000) * 20 + test_idx * 2);
+}
+
+static FalconTransportBuffer make_pattern(size_t size, uint8_t seed)
+{
+    FalconTransportBuffer ret(size);
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        ret[ii] = static_cast<uint8_t>(ii * 31 + seed);
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+FALCON_TEST(tcp_transport_exchanges_between_two_ranks)
+{
+    const std::vector<std::string> hosts = { LOOPBACK_HOST, LOOPBACK_HOST };
+    const uint16_t base_port = get_test_base_port(0);
+
+    bool rank1_ok = false;
+    FalconRankBufferMap rank1_incoming;
+
+    std::thread rank1_thread([&]() {
+        falcon_simulation_environment_tcp_transport rank1(1, hosts, base_port);
+        if (!rank1.initialize())
+        {
+            return;
+        }
+
+        FalconRankBufferMap outgoing;
+        outgoing[0] = make_pattern(LARGE_BUFFER_SIZE, 1);
+        rank1_incoming[0] = FalconTransportBuffer();
+        bool large_ok = rank1.exchange(outgoing, rank1_incoming);
+
+        /* an empty message is still delivered as a frame */
+        FalconRankBufferMap empty_outgoing;
+        FalconRankBufferMap empty_incoming;
+        empty_outgoing[0] = FalconTransportBuffer();
+        empty_incoming[0] = make_pattern(4, 0);
+        bool empty_ok = rank1.exchange(empty_outgoing, empty_incoming) && empty_incoming[0].empty();
+
+        rank1_ok = large_ok && empty_ok;
+    });
+
+    falcon_simulation_environment_tcp_transport rank0(0, hosts, base_port);
+    bool initialized = rank0.initialize();
+
+    FalconRankBufferMap outgoing;
+    FalconRankBufferMap incoming;
+    outgoing[1] = make_pattern(LARGE_BUFFER_SIZE, 0);
+    incoming[1] = FalconTransportBuffer();
+    bool large_ok = initialized && rank0.exchange(outgoing, incoming);
+
+    FalconRankBufferMap empty_outgoing;
+    FalconRankBufferMap empty_incoming;
+    empty_outgoing[1] = FalconTransportBuffer();
+    empty_incoming[1] = make_pattern(4, 0);
+    bool empty_ok = initialized && rank0.exchange(empty_outgoing, empty_incoming) && empty_incoming[1].empty();
+
+    rank1_thread.join();
+
+    FALCON_TEST_ASSERT(initialized);
+    FALCON_TEST_ASSERT_EQ(2u, rank0.get_num_ranks());
+    FALCON_TEST_ASSERT(large_ok);
+    FALCON_TEST_ASSERT(empty_ok);
+    FALCON_TEST_ASSERT(rank1_ok);
+    FALCON_TEST_ASSERT(incoming[1] == make_pattern(LARGE_BUFFER_SIZE, 1));
+    FALCON_TEST_ASSERT(rank1_incoming[0] == make_pattern(LARGE_BUFFER_SIZE, 0));
+}
+
+FALCON_TEST(tcp_transport_all_reduce_sums_across_ranks)
+{
+    const std::vector<std::string> hosts = { LOOPBACK_HOST, LOOPBACK_HOST };
+    const uint16_t base_port = get_test_base_port(1);
+    const int64_t big_value = 1LL << 40;
+
+    std::vector<int64_t> rank1_values = { 2, 7, -big_value, 0 };
+    bool rank1_ok = false;
+
+    std::thread rank1_thread([&]() {
+        falcon_simulation_environment_tcp_transport rank1(1, hosts, base_port);
+        rank1_ok = rank1.initialize() && rank1.all_reduce_sum(rank1_values) && rank1.barrier();
+    });
+
+    falcon_simulation_environment_tcp_transport rank0(0, hosts, base_port);
+    std::vector<int64_t> rank0_values = { 1, -5, 3 * big_value, 0 };
+    bool rank0_ok = rank0.initialize() && rank0.all_reduce_sum(rank0_values) && rank0.barrier();
+
+    rank1_thread.join();
+
+    FALCON_TEST_ASSERT(rank0_ok);
+    FALCON_TEST_ASSERT(rank1_ok);
+
+    const std::vector<int64_t> expected = { 3, 2, 2 * big_value, 0 };
+    FALCON_TEST_ASSERT(rank0_values == expected);
+    FALCON_TEST_ASSERT(rank1_values == expected);
+}
+
+FALCON_TEST(tcp_transport_uses_network_byte_order)
+{
+    const std::vector<std::string> hosts = { LOOPBACK_HOST, LOOPBACK_HOST };
+    const uint16_t base_port = get_test_base_port(2);
+
+    /* a hand-written rank 1 that speaks the wire format directly */
+    bool peer_ok = false;
+    uint8_t received_header[4] = { 0 };
+    std::thread peer_thread([&]() {
+        int fd = -1;
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(base_port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        for (uint32_t attempt = 0; attempt < 200 && fd < 0; ++attempt)
+        {
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+            {
+                close(fd);
+                fd = -1;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        if (fd < 0)
+        {
+            return;
+        }
+
+        const uint8_t hello[4] = { 0, 0, 0, 1 };
+        const uint8_t frame[7] = { 0, 0, 0, 3, 'a', 'b', 'c' };
+        peer_ok = send(fd, hello, sizeof(hello), 0) == sizeof(hello) &&
+                  send(fd, frame, sizeof(frame), 0) == sizeof(frame) &&
+                  recv(fd, received_header, sizeof(received_header), MSG_WAITALL) == sizeof(received_header);
+        close(fd);
+    });
+
+    falcon_simulation_environment_tcp_transport rank0(0, hosts, base_port);
+    bool initialized = rank0.initialize();
+
+    FalconRankBufferMap outgoing;
+    FalconRankBufferMap incoming;
+    outgoing[1] = FalconTransportBuffer(258, 0);
+    incoming[1] = FalconTransportBuffer();
+    bool exchanged = initialized && rank0.exchange(outgoing, incoming);
+
+    peer_thread.join();
+
+    FALCON_TEST_ASSERT(initialized);
+    FALCON_TEST_ASSERT(exchanged);
+    FALCON_TEST_ASSERT(peer_ok);
+    FALCON_TEST_ASSERT(incoming[1] == FalconTransportBuffer({ 'a', 'b', 'c' }));
+
+    /* 258 bytes, most significant byte first */
+    FALCON_TEST_ASSERT_EQ(0u, received_header[0]);
+    FALCON_TEST_ASSERT_EQ(0u, received_header[1]);
+    FALCON_TEST_ASSERT_EQ(1u, received_header[2]);
+    FALCON_TEST_ASSERT_EQ(2u, received_header[3]);
+}
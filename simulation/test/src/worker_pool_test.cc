@@ -0,0 +1,274 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     worker_pool_test.cc
+ * @author   OrthogonalHawk
+ * @date     19-Oct-2026
+ *
+ * @brief    Unit tests for the worker thread pool.
+ *
+ * @section  DESCRIPTION
+ *
+ * Covers dynamic and assigned batches, sampling the queue depth from
+ *  another thread, restoring the caller's CPU affinity and re-initialization
+ *  of a pool that has already been used.
+ *
+ * @section  HISTORY
+ *
+ * 19-Oct-2026  OrthogonalHawk  File created.
+ * 19-Oct-2026  OrthogonalHawk  Added a steal group test.
+ * 19-Oct-2026  OrthogonalHawk  Added a queue depth test.
+ * 19-Oct-2026  OrthogonalHawk  Added a CPU affinity test.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "common/falcon_simulation_environment_worker_pool.h"
+
+#include "simulation_test.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+static const uint32_t NUM_TASKS = 64;
+static const uint32_t NUM_REINITIALIZATIONS = 20;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+static void run_counted_batch(falcon_simulation_environment_worker_pool &pool)
+{
+    std::vector<std::atomic<uint32_t>> counts(NUM_TASKS);
+    for (auto &count : counts)
+    {
+        count.store(0);
+    }
+
+    pool.parallel_for(NUM_TASKS, [&counts](uint32_t task_idx) {
+        counts[task_idx]++;
+    });
+
+    for (auto &count : counts)
+    {
+        FALCON_TEST_ASSERT_EQ(1u, count.load());
+    }
+}
+
+FALCON_TEST(worker_pool_runs_every_task_once)
+{
+    falcon_simulation_environment_worker_pool pool;
+    FALCON_TEST_ASSERT(pool.initialize(4));
+    FALCON_TEST_ASSERT_EQ(4u, pool.get_num_threads());
+
+    for (uint32_t ii = 0; ii < 10; ++ii)
+    {
+        run_counted_batch(pool);
+    }
+}
+
+FALCON_TEST(worker_pool_runs_assigned_tasks_once)
+{
+    falcon_simulation_environment_worker_pool pool;
+    FALCON_TEST_ASSERT(pool.initialize(3));
+
+    FalconThreadTaskLists assignment(3);
+    for (uint32_t ii = 0; ii < NUM_TASKS; ++ii)
+    {
+        assignment[ii % 3].push_back(ii);
+    }
+
+    std::vector<std::atomic<uint32_t>> counts(NUM_TASKS);
+    for (auto &count : counts)
+    {
+        count.store(0);
+    }
+
+    pool.parallel_for_assigned(assignment, [&counts](uint32_t task_idx) {
+        counts[task_idx]++;
+    });
+
+    for (auto &count : counts)
+    {
+        FALCON_TEST_ASSERT_EQ(1u, count.load());
+    }
+}
+
+FALCON_TEST(worker_pool_steals_only_within_group)
+{
+    falcon_simulation_environment_worker_pool pool;
+    FALCON_TEST_ASSERT(pool.initialize(2));
+    pool.set_steal_groups({ 0, 1 });
+
+    /* the calling thread has nothing of its own to run and would otherwise
+     *  take its share of the other thread's list */
+    FalconThreadTaskLists assignment(2);
+    for (uint32_t ii = 0; ii < NUM_TASKS; ++ii)
+    {
+        assignment[1].push_back(ii);
+    }
+
+    const std::thread::id caller_id = std::this_thread::get_id();
+    std::atomic<uint32_t> num_on_caller(0);
+    std::atomic<uint32_t> num_completed(0);
+    pool.parallel_for_assigned(assignment, [&](uint32_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        if (std::this_thread::get_id() == caller_id)
+        {
+            num_on_caller++;
+        }
+        num_completed++;
+    });
+
+    FALCON_TEST_ASSERT_EQ(NUM_TASKS, num_completed.load());
+    FALCON_TEST_ASSERT_EQ(0u, num_on_caller.load());
+}
+
+/*
+ * @brief  Holds every task of a batch until a sampling thread has seen the
+ *          expected queue depth, and returns the depth last sampled
+ */
+static uint32_t sample_blocked_queue_depth(falcon_simulation_environment_worker_pool &pool,
+                                           const FalconThreadTaskLists *assignment, uint32_t expected_depth)
+{
+    std::atomic<bool> released(false);
+    std::atomic<uint32_t> sampled_depth(0);
+
+    std::thread sampler([&]() {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        do
+        {
+            sampled_depth = pool.get_queue_depth();
+        } while (sampled_depth != expected_depth && std::chrono::steady_clock::now() < deadline);
+        released = true;
+    });
+
+    auto task = [&released](uint32_t) {
+        while (!released)
+        {
+            std::this_thread::yield();
+        }
+    };
+
+    if (assignment == nullptr)
+    {
+        pool.parallel_for(NUM_TASKS, task);
+    }
+    else
+    {
+        pool.parallel_for_assigned(*assignment, task);
+    }
+    sampler.join();
+
+    return sampled_depth;
+}
+
+FALCON_TEST(worker_pool_reports_queue_depth)
+{
+    falcon_simulation_environment_worker_pool pool;
+    FALCON_TEST_ASSERT(pool.initialize(2));
+    FALCON_TEST_ASSERT_EQ(0u, pool.get_queue_depth());
+
+    /* each thread holds the one task it has claimed */
+    FALCON_TEST_ASSERT_EQ(NUM_TASKS - 2, sample_blocked_queue_depth(pool, nullptr, NUM_TASKS - 2));
+    FALCON_TEST_ASSERT_EQ(0u, pool.get_queue_depth());
+
+    FalconThreadTaskLists assignment(2);
+    for (uint32_t ii = 0; ii < NUM_TASKS; ++ii)
+    {
+        assignment[ii % 2].push_back(ii);
+    }
+    FALCON_TEST_ASSERT_EQ(NUM_TASKS - 2, sample_blocked_queue_depth(pool, &assignment, NUM_TASKS - 2));
+    FALCON_TEST_ASSERT_EQ(0u, pool.get_queue_depth());
+}
+
+FALCON_TEST(worker_pool_restores_caller_affinity)
+{
+    cpu_set_t original;
+    FALCON_TEST_ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(original), &original));
+
+    uint32_t first_cpu = 0;
+    while (!CPU_ISSET(first_cpu, &original))
+    {
+        first_cpu++;
+    }
+
+    falcon_simulation_environment_worker_pool pool;
+    FALCON_TEST_ASSERT(pool.initialize(2));
+    FALCON_TEST_ASSERT(pool.pin_threads({ first_cpu }));
+
+    cpu_set_t pinned;
+    FALCON_TEST_ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(pinned), &pinned));
+    FALCON_TEST_ASSERT_EQ(1, CPU_COUNT(&pinned));
+
+    pool.shutdown();
+
+    cpu_set_t restored;
+    FALCON_TEST_ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(restored), &restored));
+    FALCON_TEST_ASSERT(CPU_EQUAL(&original, &restored));
+}
+
+FALCON_TEST(worker_pool_can_be_reinitialized)
+{
+    falcon_simulation_environment_worker_pool pool;
+
+    /* a worker that reran the previous batch after re-initialization would
+     *  report completion twice, letting parallel_for() return while tasks
+     *  of the new batch are still running */
+    for (uint32_t ii = 0; ii < NUM_REINITIALIZATIONS; ++ii)
+    {
+        FALCON_TEST_ASSERT(pool.initialize(4));
+
+        std::atomic<uint32_t> num_completed(0);
+        pool.parallel_for(NUM_TASKS, [&num_completed](uint32_t) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            num_completed++;
+        });
+        FALCON_TEST_ASSERT_EQ(NUM_TASKS, num_completed.load());
+
+        pool.shutdown();
+    }
+}